@@ -0,0 +1,126 @@
+// Allocation check: counts heap allocations per frame while a sustained ripple/hover
+// workload runs on the track engine, and while a compiled timeline replays. Exits
+// non-zero if a warmed-up frame allocates.
+#include "wx_md3/core/MD3Animator.h"
+#include "wx_md3/core/MD3Timeline.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+using namespace wx_md3;
+
+static std::atomic<uint64_t> g_allocations(0);
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+// Stand-in for the animated state of an MD3Button
+struct FakeButton {
+    float rippleRadius = 0.0f;
+    int currentElevation = 1;
+    int repaints = 0;
+};
+
+// One frame of input: some buttons are clicked (ripple replays), some hovered in or out
+// (elevation retargets), then every track advances by one 16ms frame
+static void RunFrame(MD3TrackEngine& tracks, std::vector<FakeButton>& buttons, int frame) {
+    for (size_t i = 0; i < buttons.size(); ++i) {
+        FakeButton* button = &buttons[i];
+        if ((frame + i) % 37 == 0) {
+            MD3TrackId ripple = tracks.Play(MD3AnimationType::Ripple, &button->rippleRadius,
+                                            0.0f, 1.0f, 300, MD3Easing::Linear);
+            tracks.SetOnUpdateCallback(ripple, [button]() { button->repaints++; });
+            tracks.SetOnCompleteCallback(ripple, [button]() { button->rippleRadius = 0.0f; });
+        }
+        if ((frame + i) % 23 == 0) {
+            int target = ((frame / 23 + i) % 2) ? 2 : 1;
+            MD3TrackId elevation = tracks.Retarget(MD3AnimationType::Elevation, &button->currentElevation,
+                                                   target, 200, MD3Easing::EaseInOut);
+            if (elevation.IsNull()) {
+                elevation = tracks.Add(MD3AnimationType::Elevation, &button->currentElevation,
+                                       button->currentElevation, target, 200, MD3Easing::EaseInOut);
+            }
+            tracks.Start(elevation);
+            tracks.SetOnUpdateCallback(elevation, [button]() { button->repaints++; });
+        }
+    }
+    tracks.Advance(16.0f);
+}
+
+// Staggered entrance of a grid of cards: each fades and scales in, then settles
+static MD3Timeline BuildEntrance(std::vector<float>& scales, std::vector<float>& opacities) {
+    MD3Timeline timeline;
+    timeline.BeginParallel(8);
+    for (size_t i = 0; i < scales.size(); ++i) {
+        timeline.BeginSequence()
+                    .Keyframes(&scales[i], { { 0, 0.8f }, { 150, 1.05f, MD3Easing::EmphasizedDecelerate },
+                                             { 250, 1.0f, MD3Easing::Standard } })
+                    .Delay(50)
+                .End();
+        timeline.Tween(&opacities[i], 0.0f, 1.0f, 200, MD3Easing::Standard);
+    }
+    timeline.End().SetRepeat(-1, true);
+    timeline.Compile();
+    return timeline;
+}
+
+int main() {
+    const size_t buttonCount = 1000;
+    const int warmupFrames = 120;
+    const int measuredFrames = 600;
+
+    std::vector<FakeButton> buttons(buttonCount);
+    MD3TrackEngine tracks;
+
+    // Warm up: grow the columns, slot pool, key table and easing buckets to their peak
+    for (int frame = 0; frame < warmupFrames; ++frame) {
+        RunFrame(tracks, buttons, frame);
+    }
+
+    uint64_t before = g_allocations.load();
+    for (int frame = warmupFrames; frame < warmupFrames + measuredFrames; ++frame) {
+        RunFrame(tracks, buttons, frame);
+    }
+    uint64_t allocations = g_allocations.load() - before;
+
+    std::printf("buttons: %zu, frames: %d, live tracks: %zu\n", buttonCount, measuredFrames, tracks.GetTrackCount());
+    std::printf("allocations: %llu (%.3f per frame)\n", static_cast<unsigned long long>(allocations),
+                static_cast<double>(allocations) / measuredFrames);
+
+    // Timeline replay: compiled once, then only evaluated
+    std::vector<float> scales(buttonCount), opacities(buttonCount);
+    MD3TimelineAnimation entrance(BuildEntrance(scales, opacities));
+    entrance.Start();
+    for (int frame = 0; frame < warmupFrames; ++frame) {
+        entrance.Update(16.0f);
+    }
+
+    before = g_allocations.load();
+    for (int frame = 0; frame < measuredFrames; ++frame) {
+        entrance.Update(16.0f);
+    }
+    uint64_t timelineAllocations = g_allocations.load() - before;
+
+    const MD3Timeline& timeline = entrance.GetTimeline();
+    std::printf("timeline: %zu segments, %zu properties, %ld ms per pass\n",
+                timeline.GetSegmentCount(), timeline.GetChannelCount(), timeline.GetDuration());
+    std::printf("timeline allocations: %llu (%.3f per frame)\n", static_cast<unsigned long long>(timelineAllocations),
+                static_cast<double>(timelineAllocations) / measuredFrames);
+    return allocations == 0 && timelineAllocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+// Headless animator benchmark: frame update cost with 100 / 1k / 10k / 100k concurrent
+// property animations for every MD3Easing, driven by a virtual clock and Tick()
+// (no wxTimer, no display). Use it as a regression baseline for animator changes.
+#include "wx_md3/core/MD3Animator.h"
+#include <wx/init.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace wx_md3;
+
+struct NamedEasing {
+    const char* name;
+    MD3Easing easing;
+};
+
+static const NamedEasing kEasings[] = {
+    { "Linear", MD3Easing::Linear },
+    { "EaseIn", MD3Easing::EaseIn },
+    { "EaseOut", MD3Easing::EaseOut },
+    { "EaseInOut", MD3Easing::EaseInOut },
+    { "EaseInQuad", MD3Easing::EaseInQuad },
+    { "EaseOutQuad", MD3Easing::EaseOutQuad },
+    { "EaseInOutQuad", MD3Easing::EaseInOutQuad },
+    { "EaseInCubic", MD3Easing::EaseInCubic },
+    { "EaseOutCubic", MD3Easing::EaseOutCubic },
+    { "EaseInOutCubic", MD3Easing::EaseInOutCubic },
+    { "Standard", MD3Easing::Standard },
+    { "StandardAccelerate", MD3Easing::StandardAccelerate },
+    { "StandardDecelerate", MD3Easing::StandardDecelerate },
+    { "EmphasizedAccelerate", MD3Easing::EmphasizedAccelerate },
+    { "EmphasizedDecelerate", MD3Easing::EmphasizedDecelerate },
+    { "Legacy", MD3Easing::Legacy },
+};
+
+int main() {
+    wxInitializer initializer;
+    if (!initializer.IsOk()) {
+        std::fprintf(stderr, "Failed to initialize wxWidgets\n");
+        return 1;
+    }
+
+    const size_t counts[] = { 100, 1000, 10000, 100000 };
+    const int frames = 200;
+    const double frameMs = 16.0;
+
+    MD3VirtualClock clock;
+    MD3Animator& animator = MD3Animator::GetInstance();
+    animator.SetClockSource(&clock);
+    animator.SetFrameBudget(0.0f);  // Measure the full update cost, never shed
+    animator.Start();
+
+    std::printf("%-8s %-22s %14s %14s\n", "tracks", "easing", "us/frame", "ns/track");
+    for (size_t count : counts) {
+        std::vector<float> values(count);
+
+        for (const NamedEasing& named : kEasings) {
+            // Long enough that no track completes during the measured frames
+            long duration = static_cast<long>(frameMs * frames * 2);
+            for (size_t i = 0; i < count; ++i) {
+                values[i] = 0.0f;
+                animator.AnimateProperty(MD3AnimationType::Custom, &values[i], 1.0f, duration, named.easing);
+            }
+
+            clock.Advance(frameMs);
+            animator.Tick(); // warm up
+
+            auto start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < frames; ++frame) {
+                clock.Advance(frameMs);
+                animator.Tick();
+            }
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+            std::printf("%-8zu %-22s %14.2f %14.2f\n", count, named.name, us / frames,
+                        us * 1000.0 / (static_cast<double>(frames) * count));
+            animator.ClearAnimations();
+        }
+    }
+
+    animator.Stop();
+    animator.SetClockSource(nullptr);
+    return 0;
+}
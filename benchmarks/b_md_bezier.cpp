@@ -0,0 +1,66 @@
+// Cubic-bezier easing benchmark: table lookup (MD3CubicBezier::Evaluate) vs solving
+// x(t) = x directly (MD3CubicBezier::Solve) for the MD3 spec curves and a user curve.
+#include "wx_md3/core/MD3CubicBezier.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace wx_md3;
+
+struct NamedCurve {
+    const char* name;
+    MD3Easing easing;
+};
+
+template<typename F>
+static double MeasureNsPerValue(size_t count, F&& body) {
+    using clock = std::chrono::steady_clock;
+    body(); // warm up
+    const int repeats = 20;
+    auto start = clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        body();
+    }
+    double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    return ns / static_cast<double>(repeats * count);
+}
+
+int main() {
+    const NamedCurve curves[] = {
+        { "Standard", MD3Easing::Standard },
+        { "StandardAccelerate", MD3Easing::StandardAccelerate },
+        { "StandardDecelerate", MD3Easing::StandardDecelerate },
+        { "EmphasizedAccelerate", MD3Easing::EmphasizedAccelerate },
+        { "EmphasizedDecelerate", MD3Easing::EmphasizedDecelerate },
+        { "Legacy", MD3Easing::Legacy },
+        { "user (0.68,-0.6,0.32,1.6)", MD3CubicBezier::Register(0.68f, -0.6f, 0.32f, 1.6f) },
+    };
+
+    const size_t count = 1000000;
+    std::vector<float> progress(count), table(count), solved(count);
+    for (size_t i = 0; i < count; ++i) {
+        progress[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+    }
+
+    std::printf("%-28s %12s %12s %12s\n", "curve", "LUT ns", "solve ns", "max err");
+    for (const NamedCurve& named : curves) {
+        const MD3CubicBezier* curve = MD3CubicBezier::Find(named.easing);
+
+        double lutNs = MeasureNsPerValue(count, [&]() {
+            curve->EvaluateBatch(progress.data(), table.data(), count);
+        });
+        double solveNs = MeasureNsPerValue(count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                solved[i] = curve->Solve(progress[i]);
+            }
+        });
+
+        float maxError = 0.0f;
+        for (size_t i = 0; i < count; ++i) {
+            maxError = std::max(maxError, std::fabs(table[i] - solved[i]));
+        }
+        std::printf("%-28s %12.3f %12.3f %12.2e\n", named.name, lutNs, solveNs, maxError);
+    }
+    return 0;
+}
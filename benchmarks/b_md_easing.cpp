@@ -0,0 +1,129 @@
+// Batched easing micro-benchmark: scalar MD3Animation::Ease loop vs EaseBatch
+// at every SIMD level this CPU supports, plus the max error against the scalar reference.
+// Also colour interpolation: MD3Animator::LerpColour vs MD3LerpColourPlanes.
+#include "wx_md3/core/MD3Animator.h"
+#include "wx_md3/core/MD3ColourSpace.h"
+#include "wx_md3/core/MD3Simd.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace wx_md3;
+
+static const MD3Easing kEasings[] = {
+    MD3Easing::Linear, MD3Easing::EaseIn, MD3Easing::EaseOut, MD3Easing::EaseInOut,
+    MD3Easing::EaseInQuad, MD3Easing::EaseOutQuad, MD3Easing::EaseInOutQuad,
+    MD3Easing::EaseInCubic, MD3Easing::EaseOutCubic, MD3Easing::EaseInOutCubic
+};
+
+template<typename F>
+static double MeasureNsPerValue(size_t count, F&& body) {
+    using clock = std::chrono::steady_clock;
+    // Repeat so every size runs ~10M evaluations
+    size_t repeats = std::max<size_t>(1, 10000000 / count);
+    body(); // warm up
+    auto start = clock::now();
+    for (size_t r = 0; r < repeats; ++r) {
+        body();
+    }
+    double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    return ns / static_cast<double>(repeats * count);
+}
+
+int main() {
+    const size_t sizes[] = { 1000, 10000, 100000 };
+    const MD3SimdLevel supported = MD3GetSupportedSimdLevel();
+
+    std::printf("Supported SIMD level: %s\n\n", MD3GetSimdLevelName(supported));
+    std::printf("%-8s %-16s %12s", "values", "easing", "scalar ns");
+    for (int level = 0; level <= static_cast<int>(supported); ++level) {
+        std::printf(" %12s", MD3GetSimdLevelName(static_cast<MD3SimdLevel>(level)));
+    }
+    std::printf(" %10s\n", "max err");
+
+    for (size_t count : sizes) {
+        std::vector<float> progress(count), reference(count), batched(count);
+        for (size_t i = 0; i < count; ++i) {
+            progress[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+        }
+
+        for (MD3Easing easing : kEasings) {
+            double scalarNs = MeasureNsPerValue(count, [&]() {
+                for (size_t i = 0; i < count; ++i) {
+                    reference[i] = MD3Animation::Ease(progress[i], easing);
+                }
+            });
+            std::printf("%-8zu %-16d %12.3f", count, static_cast<int>(easing), scalarNs);
+
+            float maxError = 0.0f;
+            for (int level = 0; level <= static_cast<int>(supported); ++level) {
+                MD3SetSimdLevel(static_cast<MD3SimdLevel>(level));
+                double batchNs = MeasureNsPerValue(count, [&]() {
+                    MD3Animation::EaseBatch(progress.data(), batched.data(), count, easing);
+                });
+                for (size_t i = 0; i < count; ++i) {
+                    maxError = std::max(maxError, std::fabs(batched[i] - reference[i]));
+                }
+                std::printf(" %12.3f", batchNs);
+            }
+            MD3SetSimdLevel(supported);
+
+            std::printf(" %10.2e%s\n", maxError, maxError > 1e-6f ? "  FAIL" : "");
+        }
+    }
+
+    // Colours: the batch covers decode, lerp, un-premultiply and encode, like a colour track
+    std::printf("\n%-8s %-16s %12s", "colours", "", "scalar ns");
+    for (int level = 0; level <= static_cast<int>(supported); ++level) {
+        std::printf(" %12s", MD3GetSimdLevelName(static_cast<MD3SimdLevel>(level)));
+    }
+    std::printf(" %10s\n", "mismatch");
+
+    bool colourFailed = false;
+    for (size_t count : sizes) {
+        std::vector<wxColour> from(count), to(count), reference(count), batched(count);
+        std::vector<float> weights(count), planes(12 * count);
+        for (size_t i = 0; i < count; ++i) {
+            from[i] = wxColour(i * 7 % 256, i * 13 % 256, i * 29 % 256, i * 3 % 256);
+            to[i] = wxColour(i * 31 % 256, i * 5 % 256, i * 11 % 256, 255 - i % 256);
+            weights[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+        }
+        const float* start[4] = { &planes[0], &planes[count], &planes[2 * count], &planes[3 * count] };
+        const float* end[4] = { &planes[4 * count], &planes[5 * count], &planes[6 * count], &planes[7 * count] };
+        float* out[4] = { &planes[8 * count], &planes[9 * count], &planes[10 * count], &planes[11 * count] };
+
+        double scalarNs = MeasureNsPerValue(count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                reference[i] = MD3Animator::LerpColour(from[i], to[i], weights[i]);
+            }
+        });
+        std::printf("%-8zu %-16s %12.3f", count, "premul linear", scalarNs);
+
+        size_t mismatches = 0;
+        for (int level = 0; level <= static_cast<int>(supported); ++level) {
+            MD3SetSimdLevel(static_cast<MD3SimdLevel>(level));
+            double batchNs = MeasureNsPerValue(count, [&]() {
+                for (size_t i = 0; i < count; ++i) {
+                    MD3LinearColour a = MD3ToLinearColour(from[i]);
+                    MD3LinearColour b = MD3ToLinearColour(to[i]);
+                    planes[i] = a.r; planes[count + i] = a.g; planes[2 * count + i] = a.b; planes[3 * count + i] = a.a;
+                    planes[4 * count + i] = b.r; planes[5 * count + i] = b.g; planes[6 * count + i] = b.b; planes[7 * count + i] = b.a;
+                }
+                MD3LerpColourPlanes(start, end, weights.data(), out, count);
+                for (size_t i = 0; i < count; ++i) {
+                    batched[i] = MD3FromStraightLinear(out[0][i], out[1][i], out[2][i], out[3][i]);
+                }
+            });
+            for (size_t i = 0; i < count; ++i) {
+                if (batched[i] != reference[i]) mismatches++;
+            }
+            std::printf(" %12.3f", batchNs);
+        }
+        MD3SetSimdLevel(supported);
+
+        colourFailed = colourFailed || mismatches > 0;
+        std::printf(" %10zu%s\n", mismatches, mismatches > 0 ? "  FAIL" : "");
+    }
+    return colourFailed ? 1 : 0;
+}
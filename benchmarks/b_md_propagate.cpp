@@ -0,0 +1,98 @@
+// Theme change propagation with 10k live controls: registration cost, then the latency of
+// switching the current theme (every control's UpdateAppearance once, one refresh per
+// top-level window) and of changing the current theme in place. Headless, so the controls
+// have no windows to repaint; the numbers are the propagation cost itself. Exits non-zero
+// if a control was updated other than exactly once per change.
+#include "wx_md3/core/MD3Control.h"
+#include "wx_md3/core/MD3Theme.h"
+#include <wx/init.h>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace wx_md3;
+
+// Caches its colours on theme changes, like the components do
+class CachingControl : public MD3Control {
+public:
+    size_t updates = 0;
+    wxColour background;
+
+protected:
+    void UpdateAppearance() override {
+        ++updates;
+        background = MD3Theme::GetCurrent().GetStateColor(MD3ColorRole::Primary, MD3ToColorState(m_state));
+    }
+};
+
+static int CheckUpdates(const std::vector<std::unique_ptr<CachingControl>>& controls, size_t expected,
+                        const char* what) {
+    for (const auto& control : controls) {
+        if (control && control->updates != expected) {
+            std::printf("%s: a control was updated %zu times, expected %zu\n", what, control->updates, expected);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main() {
+    wxInitializer initializer;
+    if (!initializer.IsOk()) {
+        std::fprintf(stderr, "Failed to initialize wxWidgets\n");
+        return 1;
+    }
+
+    int failures = 0;
+    const size_t controlCount = 10000;
+    const int switches = 100;
+
+    std::shared_ptr<MD3Theme> light = MD3Theme::GetDefaultLightTheme();
+    std::shared_ptr<MD3Theme> dark = MD3Theme::GetDefaultDarkTheme();
+    MD3Theme::SetCurrentTheme(light);
+
+    auto createStart = std::chrono::steady_clock::now();
+    std::vector<std::unique_ptr<CachingControl>> controls;
+    controls.reserve(controlCount);
+    for (size_t i = 0; i < controlCount; ++i) {
+        controls.push_back(std::make_unique<CachingControl>());
+    }
+    double createUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - createStart).count();
+
+    // Swapping the current theme
+    auto switchStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < switches; ++i) {
+        MD3Theme::SetCurrentTheme(i % 2 ? light : dark);
+    }
+    double switchUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - switchStart).count();
+    failures += CheckUpdates(controls, switches, "SetCurrentTheme");
+
+    // Changing the current theme in place; a theme that is not current reaches nobody
+    auto typeStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < switches; ++i) {
+        light->SetThemeType(i % 2 ? MD3ThemeType::Light : MD3ThemeType::Dark);
+    }
+    double typeUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - typeStart).count();
+    dark->SetThemeType(MD3ThemeType::Light);
+    failures += CheckUpdates(controls, 2 * switches, "SetThemeType");
+
+    // Removing every other control leaves the registry dense
+    for (size_t i = 0; i < controlCount; i += 2) {
+        controls[i].reset();
+    }
+    if (MD3Control::GetRegisteredControlCount() != controlCount / 2) {
+        std::printf("registry holds %zu controls, expected %zu\n", MD3Control::GetRegisteredControlCount(),
+                    controlCount / 2);
+        failures++;
+    }
+    MD3Theme::SetCurrentTheme(dark);
+    failures += CheckUpdates(controls, 2 * switches + 1, "after removals");
+
+    std::printf("%zu controls: register %.3f us each\n", controlCount, createUs / controlCount);
+    std::printf("theme switch: %.1f us (%.1f ns per control)\n", switchUs / switches,
+                switchUs * 1000.0 / switches / controlCount);
+    std::printf("theme type change: %.1f us (%.1f ns per control)\n", typeUs / switches,
+                typeUs * 1000.0 / switches / controlCount);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+// Seed extraction from a synthetic 4K "wallpaper" (sky gradient, hills, a sun and sensor
+// noise): sampling, Wu + k-means quantization and seed scoring, timed per SIMD level of
+// the k-means assignment kernel, plus the same work on a worker thread as the UI would
+// run it. Exits non-zero if the levels disagree on the seed or the edge cases (a grey
+// image, a transparent image) do not fall back.
+#include "wx_md3/core/MD3Quantizer.h"
+#include "wx_md3/core/MD3Hct.h"
+#include "wx_md3/core/MD3Simd.h"
+#include <wx/init.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+using namespace wx_md3;
+
+static wxImage MakeWallpaper(int width, int height) {
+    wxImage image(width, height);
+    unsigned char* data = image.GetData();
+    uint32_t noise = 12345;
+    for (int y = 0; y < height; ++y) {
+        double v = static_cast<double>(y) / height;
+        for (int x = 0; x < width; ++x) {
+            double u = static_cast<double>(x) / width;
+            double r, g, b;
+            double horizon = 0.62 + 0.08 * std::sin(u * 9.0);
+            double sun = std::hypot(u - 0.72, (v - 0.3) * height / width);
+            if (sun < 0.06) {
+                r = 250; g = 170; b = 60;
+            } else if (v < horizon) {
+                r = 40 + 60 * v; g = 110 + 80 * v; b = 200 + 40 * v;
+            } else {
+                r = 50 + 30 * u; g = 120 - 40 * (v - horizon); b = 40;
+            }
+            noise = noise * 1664525u + 1013904223u;
+            int jitter = static_cast<int>((noise >> 24) % 9) - 4;
+            unsigned char* pixel = data + (static_cast<size_t>(y) * width + x) * 3;
+            pixel[0] = static_cast<unsigned char>(std::min(255.0, std::max(0.0, r + jitter)));
+            pixel[1] = static_cast<unsigned char>(std::min(255.0, std::max(0.0, g + jitter)));
+            pixel[2] = static_cast<unsigned char>(std::min(255.0, std::max(0.0, b + jitter)));
+        }
+    }
+    return image;
+}
+
+template<typename F>
+static double MeasureMs(int runs, F&& work) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; ++i) work();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+}
+
+int main() {
+    wxInitializer initializer;
+    if (!initializer.IsOk()) {
+        std::fprintf(stderr, "Failed to initialize wxWidgets\n");
+        return 1;
+    }
+
+    int failures = 0;
+    const int runs = 5;
+    wxImage wallpaper = MakeWallpaper(3840, 2160);
+
+    std::vector<MD3QuantizedColor> colours = MD3QuantizeImage(wallpaper);
+    std::vector<MD3SeedCandidate> candidates = MD3ScoreSeedColors(colours);
+    std::printf("4K wallpaper: %zu quantized colours, %zu seed candidates\n", colours.size(), candidates.size());
+    for (const MD3SeedCandidate& candidate : candidates) {
+        MD3Hct hct = MD3Hct::FromColour(candidate.colour);
+        std::printf("  #%02X%02X%02X  score %6.2f  population %5u  hue %5.1f  chroma %5.1f\n", candidate.colour.Red(),
+                    candidate.colour.Green(), candidate.colour.Blue(), candidate.score, candidate.population, hct.hue,
+                    hct.chroma);
+    }
+
+    // Whole pipeline per kernel level; the assignment kernel must match the scalar loop exactly
+    const MD3SimdLevel supported = MD3GetSupportedSimdLevel();
+    wxColour reference;
+    std::printf("%-8s %10s %10s %10s\n", "level", "sample ms", "total ms", "seed");
+    for (MD3SimdLevel level : { MD3SimdLevel::Scalar, MD3SimdLevel::SSE2, MD3SimdLevel::AVX2 }) {
+        if (static_cast<int>(level) > static_cast<int>(supported)) continue;
+        MD3SetSimdLevel(level);
+
+        MD3QuantizerOptions sampleOnly;
+        sampleOnly.maxColors = 1;
+        sampleOnly.maxIterations = 1;
+        double sampleMs = MeasureMs(runs, [&]() { MD3QuantizeImage(wallpaper, sampleOnly); });
+        wxColour seed;
+        double totalMs = MeasureMs(runs, [&]() { seed = MD3ExtractSeedColor(wallpaper); });
+        std::printf("%-8s %10.2f %10.2f    #%02X%02X%02X\n", MD3GetSimdLevelName(level), sampleMs, totalMs,
+                    seed.Red(), seed.Green(), seed.Blue());
+
+        if (level == MD3SimdLevel::Scalar) {
+            reference = seed;
+        } else if (seed != reference) {
+            std::printf("%s picked a different seed than the scalar path\n", MD3GetSimdLevelName(level));
+            failures++;
+        }
+    }
+    MD3SetSimdLevel(supported);
+
+    // Off the UI thread, as MD3ExtractSeedColorAsync runs it
+    wxColour workerSeed;
+    auto workerStart = std::chrono::steady_clock::now();
+    std::thread worker([&]() { workerSeed = MD3ExtractSeedColor(wallpaper); });
+    worker.join();
+    double workerMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - workerStart).count();
+    std::printf("worker thread: %.2f ms to a seed\n", workerMs);
+
+    // Nothing colourful, or nothing opaque: the fallback seed
+    wxImage grey(640, 480);
+    std::fill(grey.GetData(), grey.GetData() + 640 * 480 * 3, static_cast<unsigned char>(128));
+    if (MD3ExtractSeedColor(grey) != kMD3FallbackSeedColor) {
+        std::printf("grey image did not fall back\n");
+        failures++;
+    }
+    wxImage transparent = MakeWallpaper(320, 240);
+    transparent.SetAlpha();
+    std::fill(transparent.GetAlpha(), transparent.GetAlpha() + 320 * 240, static_cast<unsigned char>(0));
+    if (MD3ExtractSeedColor(transparent) != kMD3FallbackSeedColor) {
+        std::printf("transparent image did not fall back\n");
+        failures++;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
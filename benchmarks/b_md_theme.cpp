@@ -0,0 +1,167 @@
+// Theme colour lookup benchmark: the colours a button paint reads, fetched three ways:
+//   legacy  GetCurrentTheme() + std::map<wxString, wxColour> lookup (the old GetColor)
+//   names   GetCurrentTheme() + GetColor("name") (perfect-hash compatibility layer)
+//   roles   GetCurrent() + GetColor(MD3ColorRole) (array index)
+// Also checks that every role name round-trips, times a theme switch (scheme plus role
+// and state colour tables) and compares building a paint's pens and brushes against the
+// theme's resource cache, and times Material You scheme generation from a seed colour,
+// cold (HCT palettes solved) and warm (memoised). Exits non-zero on a mismatch.
+#include "wx_md3/core/MD3Theme.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+
+using namespace wx_md3;
+
+static const char* const kPaintNames[] = { "primary", "onPrimary", "surface", "onSurface",
+                                           "surfaceVariant", "onSurfaceVariant", "outline", "primary" };
+static const MD3ColorRole kPaintRoles[] = { MD3ColorRole::Primary, MD3ColorRole::OnPrimary, MD3ColorRole::Surface,
+                                            MD3ColorRole::OnSurface, MD3ColorRole::SurfaceVariant,
+                                            MD3ColorRole::OnSurfaceVariant, MD3ColorRole::Outline, MD3ColorRole::Primary };
+static const size_t kLookupsPerPaint = sizeof(kPaintNames) / sizeof(kPaintNames[0]);
+
+template<typename F>
+static double MeasureNsPerPaint(size_t paints, F&& paint) {
+    using clock = std::chrono::steady_clock;
+    unsigned long sink = 0;
+    for (size_t i = 0; i < paints / 10; ++i) sink += paint(); // warm up
+    auto start = clock::now();
+    for (size_t i = 0; i < paints; ++i) sink += paint();
+    double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    if (sink == 1) std::printf(" ");   // Keep the lookups alive
+    return ns / static_cast<double>(paints);
+}
+
+int main() {
+    int failures = 0;
+    for (size_t i = 0; i < static_cast<size_t>(MD3ColorRole::Count); ++i) {
+        MD3ColorRole role = static_cast<MD3ColorRole>(i);
+        MD3ColorRole found;
+        if (!MD3FindColorRole(MD3GetColorRoleName(role), &found) || found != role ||
+            !MD3FindColorRole(wxString(MD3GetColorRoleName(role)), &found) || found != role) {
+            std::printf("role %zu (%s) does not round-trip\n", i, MD3GetColorRoleName(role));
+            failures++;
+        }
+    }
+    const char* const unknown[] = { "", "primar", "primaryX", "Primary", "onSurfaceVariantt", "accent" };
+    for (const char* name : unknown) {
+        if (MD3FindColorRole(name, nullptr)) {
+            std::printf("unknown name '%s' matched a role\n", name);
+            failures++;
+        }
+    }
+
+    // The string-keyed map GetColor used to search
+    const MD3Theme& current = MD3Theme::GetCurrent();
+    std::map<wxString, wxColour> legacyMap;
+    for (size_t i = 0; i < static_cast<size_t>(MD3ColorRole::Count); ++i) {
+        MD3ColorRole role = static_cast<MD3ColorRole>(i);
+        legacyMap[MD3GetColorRoleName(role)] = current.GetColor(role);
+    }
+
+    const size_t paints = 1000000;
+    double legacyNs = MeasureNsPerPaint(paints, [&]() {
+        std::shared_ptr<MD3Theme> theme = MD3Theme::GetCurrentTheme();
+        unsigned long sum = 0;
+        for (const char* name : kPaintNames) sum += legacyMap.find(name)->second.Red();
+        return sum;
+    });
+    double namesNs = MeasureNsPerPaint(paints, [&]() {
+        std::shared_ptr<MD3Theme> theme = MD3Theme::GetCurrentTheme();
+        unsigned long sum = 0;
+        for (const char* name : kPaintNames) sum += theme->GetColor(name).Red();
+        return sum;
+    });
+    double rolesNs = MeasureNsPerPaint(paints, [&]() {
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+        unsigned long sum = 0;
+        for (MD3ColorRole role : kPaintRoles) sum += theme.GetColor(role).Red();
+        return sum;
+    });
+
+    // A switch re-initialises the scheme and rebuilds the role and state tables
+    MD3Theme switching(MD3ThemeType::Light);
+    const int switches = 10000;
+    auto switchStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < switches; ++i) {
+        switching.SetThemeType(i % 2 ? MD3ThemeType::Light : MD3ThemeType::Dark);
+    }
+    double switchUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - switchStart).count();
+
+    std::printf("theme switch: %.2f us (%zu roles x %zu states)\n", switchUs / switches,
+                static_cast<size_t>(MD3ColorRole::Count), static_cast<size_t>(MD3ColorState::Count));
+    std::printf("%zu lookups per paint\n", kLookupsPerPaint);
+    std::printf("%-8s %12s %12s\n", "path", "ns/paint", "speedup");
+    std::printf("%-8s %12.1f %12.1f\n", "legacy", legacyNs, 1.0);
+    std::printf("%-8s %12.1f %12.1f\n", "names", namesNs, legacyNs / namesNs);
+    std::printf("%-8s %12.1f %12.1f\n", "roles", rolesNs, legacyNs / rolesNs);
+
+    // The pens and brushes of 1000 controls repainting: fresh objects vs the cache
+    const size_t controls = 1000;
+    const MD3Theme& paintTheme = MD3Theme::GetCurrent();
+    paintTheme.ClearResourceCache();
+    double constructNs = MeasureNsPerPaint(controls * 100, [&]() {
+        wxBrush clear(paintTheme.GetColor(MD3ColorRole::Surface));
+        wxBrush background(paintTheme.GetStateColor(MD3ColorRole::Primary, MD3ColorState::Hovered));
+        wxPen border(paintTheme.GetColor(MD3ColorRole::Outline), 1);
+        wxPen check(paintTheme.GetColor(MD3ColorRole::OnPrimary), 3);
+        return static_cast<unsigned long>(clear.IsOk() + background.IsOk() + border.IsOk() + check.IsOk());
+    });
+    double cachedNs = MeasureNsPerPaint(controls * 100, [&]() {
+        const wxBrush& clear = paintTheme.GetBrush(paintTheme.GetColor(MD3ColorRole::Surface));
+        const wxBrush& background = paintTheme.GetBrush(paintTheme.GetStateColor(MD3ColorRole::Primary, MD3ColorState::Hovered));
+        const wxPen& border = paintTheme.GetPen(paintTheme.GetColor(MD3ColorRole::Outline), 1);
+        const wxPen& check = paintTheme.GetPen(paintTheme.GetColor(MD3ColorRole::OnPrimary), 3);
+        return static_cast<unsigned long>(clear.IsOk() + background.IsOk() + border.IsOk() + check.IsOk());
+    });
+
+    const MD3ThemeResourceStats& resources = paintTheme.GetResourceStats();
+    std::printf("paint resources (2 brushes, 2 pens): constructed %.1f ns, cached %.1f ns\n", constructNs, cachedNs);
+    std::printf("cache: pens %llu hits / %llu misses, brushes %llu hits / %llu misses\n",
+                static_cast<unsigned long long>(resources.penHits), static_cast<unsigned long long>(resources.penMisses),
+                static_cast<unsigned long long>(resources.brushHits), static_cast<unsigned long long>(resources.brushMisses));
+    if (resources.penMisses != 2 || resources.brushMisses != 2) {
+        std::printf("unexpected cache misses\n");
+        failures++;
+    }
+
+    // Dynamic colours: the MD3 baseline scheme was generated from #6750A4, so that seed
+    // must reproduce it (within a unit of rounding)
+    const wxColour seeds[] = { wxColour(103, 80, 164), wxColour(0, 99, 155), wxColour(56, 106, 32),
+                               wxColour(186, 26, 26), wxColour(255, 193, 7), wxColour(120, 120, 120) };
+    const size_t seedCount = sizeof(seeds) / sizeof(seeds[0]);
+    MD3Theme dynamic(MD3ThemeType::Light);
+    auto coldStart = std::chrono::steady_clock::now();
+    for (const wxColour& seed : seeds) {
+        dynamic.SetSeedColor(seed);
+    }
+    double coldUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - coldStart).count();
+
+    const int regenerations = 10000;
+    auto warmStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < regenerations; ++i) {
+        dynamic.SetSeedColor(seeds[i % seedCount]);
+    }
+    double warmUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - warmStart).count();
+
+    std::printf("dynamic scheme: %.1f us per new seed, %.2f us per known seed\n", coldUs / seedCount,
+                warmUs / regenerations);
+
+    auto near = [](const wxColour& a, const wxColour& b) {
+        return std::abs(a.Red() - b.Red()) <= 1 && std::abs(a.Green() - b.Green()) <= 1 &&
+               std::abs(a.Blue() - b.Blue()) <= 1;
+    };
+    MD3Theme baseline(MD3ThemeType::Light);
+    dynamic.SetSeedColor(seeds[0]);
+    const MD3ColorRole checked[] = { MD3ColorRole::Primary, MD3ColorRole::OnPrimary, MD3ColorRole::PrimaryContainer,
+                                     MD3ColorRole::OnPrimaryContainer, MD3ColorRole::Secondary,
+                                     MD3ColorRole::SecondaryContainer, MD3ColorRole::Error };
+    for (MD3ColorRole role : checked) {
+        if (!near(dynamic.GetColor(role), baseline.GetColor(role))) {
+            std::printf("seed #6750A4: %s differs from the baseline scheme\n", MD3GetColorRoleName(role));
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
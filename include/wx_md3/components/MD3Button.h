@@ -69,7 +69,7 @@ namespace wx_md3 {
 
     protected:
         // Internal methods
-        virtual void UpdateAppearance();
+        virtual void UpdateAppearance() override;
         virtual wxColour GetBackgroundColor() const;
         virtual wxColour GetForegroundColor() const;
         virtual wxColour GetBorderColor() const;
@@ -86,8 +86,12 @@ namespace wx_md3 {
         // ✨ 涟漪动画相关
         float m_rippleRadius;  // 涟漪半径（0.0 - 1.0）
         wxPoint m_rippleCenter;  // 涟漪中心
-        std::shared_ptr<MD3PropertyAnimation<float>> m_rippleAnimation;  // 涟漪动画
-        std::shared_ptr<MD3PropertyAnimation<int>> m_elevationAnimation;  // 阴影动画
+        MD3AnimationHandle m_rippleAnimation;     // 涟漪动画
+        MD3AnimationHandle m_elevationAnimation;  // 阴影动画
+
+        // State layer: the container colour fades between states (premultiplied linear RGB)
+        wxColour m_currentBackground;
+        MD3AnimationHandle m_backgroundAnimation;
 
     private:
         void Init();
@@ -54,7 +54,7 @@ namespace wx_md3 {
 
     protected:
         // Internal methods
-        virtual void UpdateAppearance();
+        virtual void UpdateAppearance() override;
         virtual wxColour GetBackgroundColor() const;
         virtual wxColour GetBorderColor() const;
 
@@ -65,7 +65,7 @@ namespace wx_md3 {
         int m_currentElevation;
 
         // Animation support
-        std::shared_ptr<MD3PropertyAnimation<int>> m_elevationAnimation;
+        MD3AnimationHandle m_elevationAnimation;
 
     private:
         void Init();
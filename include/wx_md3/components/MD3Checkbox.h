@@ -52,7 +52,7 @@ namespace wx_md3 {
 
     protected:
         // Internal methods
-        virtual void UpdateAppearance();
+        virtual void UpdateAppearance() override;
         virtual wxColour GetCheckColor() const;
         virtual wxColour GetBorderColor() const;
 
@@ -63,7 +63,7 @@ namespace wx_md3 {
         int m_size;         // Checkbox size (typically 24px)
         int m_strokeWidth;  // Border stroke width
         float m_checkProgress; // Animation progress 0.0 to 1.0
-        std::shared_ptr<MD3PropertyAnimation<float>> m_checkAnimation;  // Checkmark animation
+        MD3AnimationHandle m_checkAnimation;  // Checkmark animation
 
     private:
         void Init();
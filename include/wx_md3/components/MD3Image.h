@@ -6,6 +6,7 @@
 #include <wx/bitmap.h>
 #include <wx/image.h>
 #include <wx/graphics.h>
+#include <functional>
 #include <unordered_map>
 #include <list>
 #include <utility>
@@ -62,6 +63,11 @@ namespace wx_md3 {
         void SetCacheSize(size_t maxSize) { m_cacheMaxSize = maxSize; }
         size_t GetCacheSize() const { return m_cacheMaxSize; }
 
+        // Dynamic colour from the shown bitmap (wallpaper, avatar): the seed is extracted on a
+        // worker thread (see MD3Quantizer.h) and passed to onSeed on the UI thread, unless this
+        // control is gone by then. Without a callback it becomes the current theme's seed.
+        void ExtractSeedColorAsync(std::function<void(const wxColour&)> onSeed = nullptr);
+
         // Override MD3Control methods
         virtual void SetState(MD3State state) override;
         virtual void Render(wxDC& dc) override;
@@ -95,7 +101,7 @@ namespace wx_md3 {
         };
 
         // Internal methods
-        virtual void UpdateAppearance();
+        virtual void UpdateAppearance() override;
         void InvalidateCache();
         wxBitmap CreateProcessedBitmap(const wxBitmap& source, const wxSize& targetSize, MD3ImageShape shape, int cornerRadius, MD3ImageQuality quality = MD3ImageQuality::High);
         void DrawParentBackground(wxDC& dc, const wxRect& rect);
@@ -52,7 +52,7 @@ namespace wx_md3 {
 
     protected:
         // Internal methods
-        virtual void UpdateAppearance();
+        virtual void UpdateAppearance() override;
         virtual wxColour GetRadioColor() const;
         virtual wxColour GetBorderColor() const;
 
@@ -2,6 +2,7 @@
 #define MD3SWITCH_H
 
 #include "wx_md3/core/MD3Control.h"
+#include "wx_md3/core/MD3PhysicsAnimation.h"
 #include <wx/radiobut.h>
 
 namespace wx_md3 {
@@ -52,7 +53,7 @@ namespace wx_md3 {
 
     protected:
         // Internal methods
-        virtual void UpdateAppearance();
+        virtual void UpdateAppearance() override;
         virtual wxColour GetTrackColor() const;
         virtual wxColour GetThumbColor() const;
 
@@ -63,7 +64,7 @@ namespace wx_md3 {
         int m_thumbSize;    // Thumb circle size (typically 24px)
         int m_trackHeight;  // Track height (typically 28px)
         float m_slideProgress; // Animation progress 0.0 to 1.0
-        std::shared_ptr<MD3PropertyAnimation<float>> m_slideAnimation;  // Thumb slide animation
+        std::shared_ptr<MD3SpringAnimation> m_slideSpring;  // Thumb slide spring (retargeted on toggle)
 
     private:
         void Init();
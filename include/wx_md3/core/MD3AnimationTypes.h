@@ -0,0 +1,130 @@
+#ifndef MD3ANIMATIONTYPES_H
+#define MD3ANIMATIONTYPES_H
+
+namespace wx_md3 {
+
+    // Animation types as defined in the blueprint
+    enum class MD3AnimationType {
+        Ripple,
+        Elevation,
+        Hover,
+        LabelFloat,
+        ThumbSlide,
+        ScaleFade,
+        IndicatorSlide,
+        CursorBlink,
+        ProgressAnimate,
+        Custom,
+        Count // Must be last
+    };
+
+    // Easing functions for animations
+    enum class MD3Easing {
+        Linear,
+        EaseIn,
+        EaseOut,
+        EaseInOut,
+        EaseInQuad,
+        EaseOutQuad,
+        EaseInOutQuad,
+        EaseInCubic,
+        EaseOutCubic,
+        EaseInOutCubic,
+
+        // MD3 motion spec curves (cubic-bezier, see MD3CubicBezier.h)
+        Standard,               // cubic-bezier(0.2, 0, 0, 1)
+        StandardAccelerate,     // cubic-bezier(0.3, 0, 1, 1)
+        StandardDecelerate,     // cubic-bezier(0, 0, 0, 1)
+        EmphasizedAccelerate,   // cubic-bezier(0.3, 0, 0.8, 0.15)
+        EmphasizedDecelerate,   // cubic-bezier(0.05, 0.7, 0.1, 1)
+        Legacy,                 // cubic-bezier(0.4, 0, 0.2, 1)
+
+        // First id handed out by MD3CubicBezier::Register for user-defined curves
+        CubicBezierBase = 32
+    };
+
+    // Animation state
+    enum class MD3AnimationState {
+        Stopped,
+        Playing,
+        Paused,
+        Completed
+    };
+
+    // How much an animation matters when frames run over budget (see
+    // MD3Animator::SetFrameBudget): cosmetic ones are degraded first, informative never
+    enum class MD3AnimationPriority {
+        Cosmetic,       // Ripples, hover and elevation feedback
+        Normal,         // State transitions (thumb slide, check mark, label float, ...)
+        Informative,    // Conveys progress or state (progress indicator, cursor blink)
+        Count // Must be last
+    };
+
+    // Default priority of each animation type
+    inline MD3AnimationPriority MD3DefaultPriority(MD3AnimationType type) {
+        switch (type) {
+            case MD3AnimationType::Ripple:
+            case MD3AnimationType::Hover:
+            case MD3AnimationType::Elevation:
+                return MD3AnimationPriority::Cosmetic;
+            case MD3AnimationType::ProgressAnimate:
+            case MD3AnimationType::CursorBlink:
+                return MD3AnimationPriority::Informative;
+            default:
+                return MD3AnimationPriority::Normal;
+        }
+    }
+
+    // What happens to an animation while its owner window is not visible
+    // (hidden, minimized, on an unselected page or clipped out of its parents)
+    enum class MD3CullMode {
+        None,       // Keep animating as usual
+        Pause,      // Freeze in place and resume where it left off once visible again
+        Finish      // Jump to the end state (completion callbacks still run)
+    };
+
+    // Global motion policy (see MD3Animator::SetMotionMode), for remote desktop / VDI
+    // sessions, X forwarding and users who ask for less motion
+    enum class MD3MotionMode {
+        Full,       // Every transition animates at the normal frame rate
+        Reduced,    // Transitions jump to their end state with a single repaint
+        LowPower    // Cosmetic feedback is skipped, the rest animates at a low frame rate
+    };
+
+    // Shared periodic clocks (see MD3Animator::SubscribePhase)
+    enum class MD3PhaseClock {
+        Blink,      // Text carets: visible during the first half of each period
+        Progress,   // Indeterminate progress indicators: continuous phase in [0, 1)
+        Count // Must be last
+    };
+
+    // Animation value type - can be float, color, position, etc.
+    struct MD3AnimationValue {
+        enum class Type {
+            Float,
+            Int,
+            Point,
+            Color
+        } type;
+        union {
+            float floatValue;
+            int intValue;
+            struct {
+                float x, y;
+            } pointValue;
+            struct {
+                unsigned char r, g, b, a;
+            } colorValue;
+        };
+
+        MD3AnimationValue() : type(Type::Float), floatValue(0.0f) {}
+        explicit MD3AnimationValue(float f) : type(Type::Float), floatValue(f) {}
+        explicit MD3AnimationValue(int i) : type(Type::Int), intValue(i) {}
+        MD3AnimationValue(float x, float y) : type(Type::Point) { pointValue.x = x; pointValue.y = y; }
+        MD3AnimationValue(unsigned char r, unsigned char g, unsigned char b, unsigned char a = 255)
+            : type(Type::Color) { colorValue.r = r; colorValue.g = g; colorValue.b = b; colorValue.a = a; }
+    };
+
+} // namespace wx_md3
+
+#endif // MD3ANIMATIONTYPES_H
\ No newline at end of file
@@ -3,75 +3,77 @@
 
 #include <wx/wx.h>
 #include <wx/timer.h>
+#include <wx/weakref.h>
 #include <memory>
 #include <vector>
 #include <functional>
 #include <map>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+#include <atomic>
+#include "wx_md3/core/MD3AnimationTypes.h"
+#include "wx_md3/core/MD3TrackEngine.h"
+#include "wx_md3/core/MD3InplaceFunction.h"
+#include "wx_md3/core/MD3AnimatorProfiler.h"
+#include "wx_md3/core/MD3MpscQueue.h"
 
 namespace wx_md3 {
 
-    // Animation types as defined in the blueprint
-    enum class MD3AnimationType {
-        Ripple,
-        Elevation,
-        Hover,
-        LabelFloat,
-        ThumbSlide,
-        ScaleFade,
-        IndicatorSlide,
-        CursorBlink,
-        ProgressAnimate,
-        Custom,
-        Count // Must be last
+    // Time source for the frame clock (ms). Install an MD3VirtualClock through
+    // MD3Animator::SetClockSource to drive animations deterministically.
+    class MD3ClockSource {
+    public:
+        virtual ~MD3ClockSource() {}
+        virtual double Now() const = 0;
     };
 
-    // Easing functions for animations
-    enum class MD3Easing {
-        Linear,
-        EaseIn,
-        EaseOut,
-        EaseInOut,
-        EaseInQuad,
-        EaseOutQuad,
-        EaseInOutQuad,
-        EaseInCubic,
-        EaseOutCubic,
-        EaseInOutCubic
-    };
+    // Hand-advanced clock for tests and benchmarks
+    class MD3VirtualClock : public MD3ClockSource {
+    public:
+        explicit MD3VirtualClock(double startTime = 0.0) : m_time(startTime) {}
 
-    // Animation state
-    enum class MD3AnimationState {
-        Stopped,
-        Playing,
-        Paused,
-        Completed
+        double Now() const override { return m_time; }
+        void Advance(double milliseconds) { m_time += milliseconds; }
+        void SetTime(double time) { m_time = time; }
+
+    private:
+        double m_time;
     };
 
-    // Animation value type - can be float, color, position, etc.
-    struct MD3AnimationValue {
-        enum class Type {
-            Float,
-            Int,
-            Point,
-            Color
-        } type;
-        union {
-            float floatValue;
-            int intValue;
-            struct {
-                float x, y;
-            } pointValue;
-            struct {
-                unsigned char r, g, b, a;
-            } colorValue;
-        };
+    // Monotonic frame clock shared by all animations (steady_clock unless a source is set)
+    class MD3FrameClock {
+    public:
+        MD3FrameClock();
+
+        // Read time from source instead of the steady clock (nullptr restores it)
+        void SetSource(const MD3ClockSource* source);
+
+        // Current time of the active source (ms)
+        double Read() const;
+
+        // Begin a new frame and return the elapsed time since the previous one (ms),
+        // clamped to the maximum frame delta so a stall does not skip whole transitions
+        float BeginFrame();
 
-        MD3AnimationValue() : type(Type::Float), floatValue(0.0f) {}
-        explicit MD3AnimationValue(float f) : type(Type::Float), floatValue(f) {}
-        explicit MD3AnimationValue(int i) : type(Type::Int), intValue(i) {}
-        MD3AnimationValue(float x, float y) : type(Type::Point) { pointValue.x = x; pointValue.y = y; }
-        MD3AnimationValue(unsigned char r, unsigned char g, unsigned char b, unsigned char a = 255)
-            : type(Type::Color) { colorValue.r = r; colorValue.g = g; colorValue.b = b; colorValue.a = a; }
+        // Forget the previous frame; the next BeginFrame() measures from now
+        void Reset();
+
+        // Timestamp (ms on the steady clock) and delta of the current frame
+        double GetFrameTime() const { return m_frameTime; }
+        float GetFrameDelta() const { return m_frameDelta; }
+
+        void SetMaxFrameDelta(float maxDelta) { m_maxFrameDelta = maxDelta; }
+        float GetMaxFrameDelta() const { return m_maxFrameDelta; }
+
+        // Current steady clock time in milliseconds
+        static double Now();
+
+    private:
+        const MD3ClockSource* m_source;
+        double m_frameTime;
+        float m_frameDelta;
+        float m_maxFrameDelta;
     };
 
     // Base animation class
@@ -81,10 +83,10 @@ namespace wx_md3 {
         virtual ~MD3Animation();
 
         // Start/stop animation
-        void Start();
-        void Stop();
-        void Pause();
-        void Resume();
+        virtual void Start();
+        virtual void Stop();
+        virtual void Pause();
+        virtual void Resume();
 
         // Update animation (called by animator)
         virtual void Update(float deltaTime) = 0;
@@ -92,71 +94,167 @@ namespace wx_md3 {
 
         // Getters
         MD3AnimationType GetType() const { return m_type; }
-        MD3AnimationState GetState() const { return m_state; }
+        virtual MD3AnimationState GetState() const { return m_state; }
         long GetDuration() const { return m_duration; }
-        long GetElapsedTime() const { return m_elapsedTime; }
+        virtual long GetElapsedTime() const { return static_cast<long>(m_elapsedTime); }
 
         // Callbacks
-        using AnimationCallback = std::function<void()>;
-        void SetOnStartCallback(AnimationCallback callback) { m_onStart = callback; }
-        void SetOnUpdateCallback(AnimationCallback callback) { m_onUpdate = callback; }
-        void SetOnCompleteCallback(AnimationCallback callback) { m_onComplete = callback; }
+        using AnimationCallback = MD3Callback;
+        virtual void SetOnStartCallback(AnimationCallback callback) { m_onStart = callback; }
+        virtual void SetOnUpdateCallback(AnimationCallback callback) { m_onUpdate = callback; }
+        virtual void SetOnCompleteCallback(AnimationCallback callback) { m_onComplete = callback; }
+
+        // Owner window for visibility culling (see MD3Animator::SetCullMode) and cancellation
+        // (MD3Animator::CancelOwner); set it before the animation is added. Custom animations
+        // are paused while their owner is culled.
+        void SetOwner(wxWindow* owner) { m_owner = owner; }
+        wxWindow* GetOwner() const { return m_owner; }
+
+        // Load-shedding priority (see MD3Animator::SetFrameBudget); defaults by type
+        virtual void SetPriority(MD3AnimationPriority priority) { m_priority = priority; }
+        MD3AnimationPriority GetPriority() const { return m_priority; }
 
         // Easing function helpers (public for external use)
         static float Ease(float t, MD3Easing easing);
         static float Lerp(float start, float end, float t);
 
+        // Batched easing: out[i] = Ease(progress[i], easing) using the best available
+        // SIMD kernel (see MD3Simd.h); matches Ease() to within 1e-6
+        static void EaseBatch(const float* progress, float* out, size_t count, MD3Easing easing);
+
     protected:
+        friend class MD3Animator;
+
+        // Timestamp of the frame currently being animated (ms on the steady clock)
+        static double GetFrameTime();
+
+        // Batched animations are advanced by MD3TrackEngine instead of Update();
+        // the animator attaches them when added and detaches them when removed
+        virtual bool IsBatched() const { return false; }
+        virtual void Attach() {}
+        virtual void Detach() {}
+
+        // Jump to the end state at once (Reduced motion); by default one very long Update()
+        virtual void Settle();
+
         MD3AnimationType m_type;
         MD3AnimationState m_state;
         long m_duration;
-        long m_elapsedTime;
+        float m_elapsedTime;
         MD3Easing m_easing;
+        wxWindow* m_owner;
+        MD3AnimationPriority m_priority;
+        float m_deferredTime;    // Time held back while shed to a lower update rate (ms)
+        uint32_t m_ownerGroup;   // Animator owner group while added (0 = none)
+        size_t m_animatorIndex;  // Position in the animator's custom animation list
 
         AnimationCallback m_onStart;
         AnimationCallback m_onUpdate;
         AnimationCallback m_onComplete;
     };
 
-    // Simple property animation
+    // Property animation: a thin handle onto a track in the animator's batched engine.
+    // Releasing the handle does not stop the track; the animator owns it until it completes.
+    // Types without a track kind (MD3TrackTraits, e.g. double or long) are not batched:
+    // they run as an ordinary animation interpolating start + (end - start) * t.
     template<typename T>
     class MD3PropertyAnimation : public MD3Animation {
     public:
         MD3PropertyAnimation(MD3AnimationType type, T* target, T startValue, T endValue,
                            long duration = 300, MD3Easing easing = MD3Easing::EaseInOut)
-            : MD3Animation(type, duration, easing), m_target(target), m_startValue(startValue), m_endValue(endValue) {}
+            : MD3Animation(type, duration, easing), m_target(target), m_startValue(startValue),
+              m_endValue(endValue), m_attached(false) {}
 
-        void Update(float deltaTime) override {
-            if (m_state != MD3AnimationState::Playing) return;
+        void Start() override;
+        void Stop() override;
+        void Pause() override;
+        void Resume() override;
 
-            m_elapsedTime += static_cast<long>(deltaTime);
-            if (m_elapsedTime >= m_duration) {
-                if (m_target) *m_target = m_endValue;
-                m_state = MD3AnimationState::Completed;
-                if (m_onComplete) m_onComplete();
-                return;
-            }
+        // Tracks are advanced in batch by MD3TrackEngine; only unbatched types update here
+        void Update(float deltaTime) override;
+        bool IsCompleted() const override { return GetState() == MD3AnimationState::Completed; }
 
-            float t = static_cast<float>(m_elapsedTime) / static_cast<float>(m_duration);
-            t = Ease(t, m_easing);
+        MD3AnimationState GetState() const override;
+        long GetElapsedTime() const override;
 
-            if (m_target) *m_target = Lerp(m_startValue, m_endValue, t);
-            if (m_onUpdate) m_onUpdate();
-        }
+        void SetOnStartCallback(AnimationCallback callback) override;
+        void SetOnUpdateCallback(AnimationCallback callback) override;
+        void SetOnCompleteCallback(AnimationCallback callback) override;
+        void SetPriority(MD3AnimationPriority priority) override;
 
-        bool IsCompleted() const override {
-            return m_state == MD3AnimationState::Completed;
-        }
+        MD3TrackId GetTrackId() const { return m_track; }
+
+    protected:
+        bool IsBatched() const override { return MD3TrackTraits<T>::batched; }
+        void Attach() override;
+        void Detach() override;
 
     private:
         T* m_target;
         T m_startValue;
         T m_endValue;
+        MD3TrackId m_track;
+        bool m_attached;
 
-        static T Lerp(const T& start, const T& end, float t) {
-            // Default implementation for numeric types
-            return start + (end - start) * t;
-        }
+        void CreateTrack();
+    };
+
+    // Lightweight, copyable reference to a batched track (no allocation, no ownership).
+    // Once the track finishes and is recycled the handle goes stale: queries report
+    // Completed and control calls are ignored.
+    class MD3AnimationHandle {
+    public:
+        MD3AnimationHandle() = default;
+        explicit MD3AnimationHandle(MD3TrackId track) : m_track(track) {}
+
+        bool IsValid() const;
+        MD3AnimationState GetState() const;
+        bool IsPlaying() const { return GetState() == MD3AnimationState::Playing; }
+        long GetElapsedTime() const;
+
+        void Start();
+        void Stop();
+        void Pause();
+        void Resume();
+        void Remove();
+
+        void SetOnStartCallback(MD3Callback callback);
+        void SetOnUpdateCallback(MD3Callback callback);
+        void SetOnCompleteCallback(MD3Callback callback);
+
+        // Cull the track with this window (see MD3Animator::SetCullMode)
+        void SetOwner(wxWindow* owner);
+
+        // Load-shedding priority (see MD3Animator::SetFrameBudget)
+        void SetPriority(MD3AnimationPriority priority);
+
+        MD3TrackId GetTrackId() const { return m_track; }
+
+    private:
+        MD3TrackId m_track;
+    };
+
+    // Animator timer statistics
+    struct MD3AnimatorStats {
+        uint64_t timerWakeups = 0;   // Timer events handled
+        uint64_t idlePeriods = 0;    // Times the timer was disarmed because nothing was playing
+        uint64_t retargets = 0;      // AnimateProperty calls that redirected a live track
+        uint64_t repaintRequests = 0;  // RequestRepaint calls made during frames
+        uint64_t repaintsFlushed = 0;  // Windows actually repainted at the end of frames
+        uint64_t repaintsSaved = 0;    // Requests merged into a repaint already queued this frame
+        uint64_t repaintsCulled = 0;   // Requests dropped because the window was culled
+        uint64_t culledTracks = 0;     // Track-frames held back by MD3CullMode::Pause
+        uint64_t cullPolls = 0;        // Frames run at the slow poll interval (everything culled)
+        uint64_t overBudgetFrames = 0; // Frames whose load exceeded the frame budget
+        uint64_t shedSkipped = 0;      // Track/animation updates skipped by load shedding
+        uint64_t shedFinished = 0;     // Tracks finished early by load shedding or the motion mode
+        uint64_t shedLevelChanges = 0; // Times the shed level went up or down
+        uint64_t postsApplied = 0;     // Posted updates applied (at most one per property per frame)
+        uint64_t postsCoalesced = 0;   // Posted updates overwritten by a later one in the same frame
+        uint64_t postsDropped = 0;     // PostProperty calls that found the queue full
+        uint64_t postsDiscarded = 0;   // Posted updates whose owner was destroyed or never registered
+        uint64_t phaseEvaluations = 0; // Shared phase clock advances (one per clock per frame)
+        uint64_t phaseRepaints = 0;    // Repaint requests made for phase clock subscribers
     };
 
     // Main animator class
@@ -174,6 +272,22 @@ namespace wx_md3 {
             MD3AnimationType type, T* target, T startValue, T endValue,
             long duration = 300, MD3Easing easing = MD3Easing::EaseInOut);
 
+        // Animate *target towards endValue, keyed by (target, type): if a track for the
+        // same property is still live it is retargeted in place from its current value
+        // and velocity instead of stacking a second animation on the same property.
+        // owner (normally the control holding *target) enables visibility culling.
+        template<typename T>
+        MD3AnimationHandle AnimateProperty(
+            MD3AnimationType type, T* target, T endValue,
+            long duration = 300, MD3Easing easing = MD3Easing::EaseInOut, wxWindow* owner = nullptr);
+
+        // Play *target from startValue to endValue, restarting the property's live track
+        // in place if there is one (e.g. a ripple replayed on every click)
+        template<typename T>
+        MD3AnimationHandle PlayProperty(
+            MD3AnimationType type, T* target, T startValue, T endValue,
+            long duration = 300, MD3Easing easing = MD3Easing::EaseInOut, wxWindow* owner = nullptr);
+
         void AddAnimation(std::shared_ptr<MD3Animation> animation);
         void RemoveAnimation(std::shared_ptr<MD3Animation> animation);
         void ClearAnimations();
@@ -182,16 +296,227 @@ namespace wx_md3 {
         void Start();
         void Stop();
 
+        // Re-arm the frame timer if it went idle (no-op while stopped or already ticking)
+        void Wake();
+        bool IsIdle() const { return !m_timerActive; }
+
+        // Frame-coalesced invalidation: during a frame, requests are collected and every
+        // window is refreshed and updated at most once after all animations have advanced.
+        // Outside a frame the window is simply refreshed.
+        void RequestRepaint(wxWindow* window);
+        void RequestRepaint(wxWindow* window, const wxRect& rect);
+
+        // Visibility culling: every frame, owners with live animations are checked and,
+        // while hidden, minimized, on an unselected page or clipped out of their parents,
+        // their tracks are paused or finished and their repaint requests dropped. A culled
+        // owner is refreshed once it becomes visible again. When only culled tracks are
+        // playing the timer slows down to the cull poll interval.
+        void SetTrackOwner(MD3TrackId track, wxWindow* owner);
+        void SetCullMode(MD3CullMode mode) { m_cullMode = mode; }   // Default for new owners
+        MD3CullMode GetCullMode() const { return m_cullMode; }
+        void SetCullMode(wxWindow* owner, MD3CullMode mode);
+        bool IsCulled(wxWindow* owner) const;
+        void SetCullPollInterval(int milliseconds) { m_cullPollInterval = milliseconds; }
+
+        // Frame budget (ms, default 8, 0 disables shedding). A frame's load is the animator's
+        // own update + repaint time, plus the timer lateness beyond one missed frame (the
+        // event loop is saturated). While the smoothed load stays over budget the shed level
+        // rises one step every few frames, and it falls back once load stays under half the
+        // budget:
+        //   level 1: cosmetic animations update every other frame
+        //   level 2: cosmetic tracks finish at once, normal ones update every other frame
+        // Informative animations are never shed. Skipped updates still advance time, so
+        // shed animations end on schedule; custom animations cannot jump to their end and
+        // are updated every fourth frame instead.
+        void SetFrameBudget(float milliseconds);
+        float GetFrameBudget() const { return m_frameBudget; }
+        int GetShedLevel() const { return m_shedLevel; }
+
+        // Motion mode (default: DetectMotionMode()). In Reduced mode tracks and finite custom
+        // animations jump to their end state on the next frame, so a transition costs a
+        // single repaint; in LowPower mode cosmetic tracks do so and everything else runs at
+        // the low-power frame interval (default 100 ms). Controls ask ShouldAnimate() first
+        // and skip their transitions altogether when it returns false.
+        void SetMotionMode(MD3MotionMode mode);
+        MD3MotionMode GetMotionMode() const { return m_motionMode; }
+        bool ShouldAnimate(MD3AnimationType type) const;
+        void SetLowPowerFrameInterval(int milliseconds);
+
+        // WX_MD3_MOTION=full|reduced|low-power if set, otherwise Reduced in a remote session
+        // (RDP on Windows, a remote X display elsewhere) and Full on a local one
+        static MD3MotionMode DetectMotionMode();
+
+        // Cancel every animation owned by the window in O(1): its tracks stop immediately
+        // without callbacks and are reclaimed lazily. Called from ~MD3Control and from a
+        // wxEVT_DESTROY hook on every other owner, so targets inside a destroyed window are
+        // never written again. Animations started without an owner are not covered.
+        void CancelOwner(wxWindow* owner);
+
+        // Thread-safe updates: any thread may post "animate *target to value" (T is float,
+        // int, wxColour or wxRealPoint). Posts go through a lock-free queue and are drained
+        // at the start of the next frame, last write wins per (target, type), so however
+        // fast workers post each property is retargeted at most once per frame. Returns
+        // false when the queue is full. A posted owner must have been registered with
+        // RegisterOwner() on the UI thread; posts for a destroyed owner are discarded, so
+        // its targets are never written. Without an owner the caller guarantees the target
+        // outlives the post. The animator itself must already exist (GetInstance() on the
+        // UI thread) before workers post.
+        template<typename T>
+        bool PostProperty(MD3AnimationType type, T* target, const T& value,
+                          long duration = 300, MD3Easing easing = MD3Easing::EaseInOut, wxWindow* owner = nullptr);
+        void RegisterOwner(wxWindow* owner);
+
+        // Shared phase clocks for periodic visuals (text carets, indeterminate progress).
+        // Each clock advances once per frame however many windows subscribe. Subscribers
+        // draw from GetPhase() / IsBlinkOn() in their paint handler; the animator only
+        // invalidates their rect (the whole window if empty) when the visual changes: every
+        // frame for Progress, on each on/off flip for Blink. One subscription per (clock,
+        // window), subscribing again moves the rect; it ends with the window. Culled
+        // subscribers are not repainted, and in Reduced motion the caret stays on. While
+        // carets are all that is live, the timer sleeps until the next flip.
+        void SubscribePhase(MD3PhaseClock clock, wxWindow* window, const wxRect& rect = wxRect());
+        void UnsubscribePhase(MD3PhaseClock clock, wxWindow* window);
+        float GetPhase(MD3PhaseClock clock) const;
+        bool IsBlinkOn() const { return GetPhase(MD3PhaseClock::Blink) < 0.5f; }
+        void RestartPhase(MD3PhaseClock clock);   // e.g. show the caret again after a key press
+        void SetPhasePeriod(MD3PhaseClock clock, long milliseconds);   // Default: system caret blink, 2000
+
+        // Timer statistics
+        const MD3AnimatorStats& GetStats() const { return m_stats; }
+        void ResetStats() { m_stats = MD3AnimatorStats(); }
+
         // Update all animations (called by timer)
         void OnTimer(wxTimerEvent& event);
 
-        // Utility functions
+        // Run one frame by hand (headless tests/benchmarks; no wxTimer or display needed)
+        void Tick();
+
+        // Read frame time from source (not owned) instead of the steady clock. A custom
+        // source also switches to manual ticking: the wxTimer is never armed and frames
+        // run only from Tick(). nullptr restores the steady clock and the timer.
+        void SetClockSource(const MD3ClockSource* source);
+
+        // Opt-in frame profiler (see MD3AnimatorProfiler.h); GetProfiler() is null when disabled
+        void EnableProfiler(bool enable, size_t capacity = 1024);
+        MD3AnimatorProfiler* GetProfiler() const { return m_profiler.get(); }
+
+        // Batched property tracks
+        MD3TrackEngine& GetTrackEngine() { return m_tracks; }
+
+        // Frame clock
+        const MD3FrameClock& GetFrameClock() const { return m_frameClock; }
+        void SetMaxFrameDelta(float maxDelta) { m_frameClock.SetMaxFrameDelta(maxDelta); }
+
+        // Colour interpolation in premultiplied linear light (see MD3ColourSpace.h)
         static wxColour LerpColour(const wxColour& start, const wxColour& end, float t);
 
     private:
-        wxTimer m_timer;
+        struct DirtyWindow {
+            wxWeakRef<wxWindow> window;   // Callbacks may destroy the window before the flush
+            wxRect rect;
+            bool whole;
+        };
+
+        // An update posted from any thread; the payload's type selects the track kind
+        struct PostedUpdate {
+            void* target = nullptr;
+            wxWindow* owner = nullptr;
+            long duration = 0;
+            MD3AnimationType type = MD3AnimationType::Custom;
+            MD3Easing easing = MD3Easing::Linear;
+            MD3AnimationValue value;
+        };
+
+        // Owner window of a track engine group (m_owners is indexed by group id)
+        struct Owner {
+            wxWeakRef<wxWindow> window;
+            wxWindow* key = nullptr;     // Registered pointer (the weak ref clears on destroy)
+            MD3CullMode mode = MD3CullMode::Finish;
+            uint32_t animations = 0;     // Custom animations in m_animations
+            bool culled = false;
+            bool cancelled = false;      // Waiting for its tracks and animations to drain
+            uint32_t phaseSlots[static_cast<size_t>(MD3PhaseClock::Count)] = {};   // Subscriber index + 1
+        };
+
+        struct PhaseSubscriber {
+            wxWindow* window;
+            uint32_t group;
+            wxRect rect;
+        };
+
+        // A shared periodic clock; steps > 0 means the visual only changes at 1/steps boundaries
+        struct PhaseClock {
+            double elapsed = 0.0;
+            long period = 1000;
+            int steps = 0;
+            int step = -1;
+            float phase = 0.0f;
+            std::vector<PhaseSubscriber> subscribers;
+        };
+
+        std::unique_ptr<wxTimer> m_timer;
+        MD3FrameClock m_frameClock;
+        MD3TrackEngine m_tracks;
         std::vector<std::shared_ptr<MD3Animation>> m_animations;
         bool m_isRunning;
+        bool m_timerActive;
+        bool m_manualTicking;
+        int m_frameInterval;
+        int m_timerInterval;          // Interval the timer is currently armed with
+        MD3AnimatorStats m_stats;
+        bool m_inFrame;
+        std::vector<DirtyWindow> m_dirtyWindows;
+        std::vector<uint32_t> m_dirtyTable;   // Open-addressed window -> m_dirtyWindows index + 1
+        std::unique_ptr<MD3AnimatorProfiler> m_profiler;
+        std::vector<Owner> m_owners;
+        std::unordered_map<wxWindow*, uint32_t> m_ownerGroups;
+        MD3CullMode m_cullMode;
+        size_t m_culledOwners;
+        int m_cullPollInterval;
+        bool m_slowPolling;
+        bool m_phaseWait;            // One-shot timer to the next phase step (only stepped clocks live)
+        float m_frameBudget;
+        float m_frameLoad;           // Smoothed per-frame load (ms)
+        int m_shedLevel;
+        MD3MotionMode m_motionMode;
+        int m_lowPowerFrameInterval;
+        int m_budgetStreak;          // Consecutive frames supporting a shed level change
+        uint32_t m_frameIndex;
+        bool m_updatingAnimations;
+        bool m_animationHoles;       // m_animations has null entries left by removals mid-frame
+        MD3MpscQueue<PostedUpdate> m_posted;
+        std::atomic<bool> m_postWakePending;   // A wake event is queued for the UI thread
+        std::atomic<uint64_t> m_postsDropped;
+        std::vector<PostedUpdate> m_postBatch;  // This frame's updates, one per property
+        std::vector<uint32_t> m_postTable;      // Open-addressed (target, type) -> m_postBatch index + 1
+        PhaseClock m_phaseClocks[static_cast<size_t>(MD3PhaseClock::Count)];
+
+        bool HasPlayingAnimations() const;
+        bool Post(const PostedUpdate& update);
+        void OnPostWake(wxThreadEvent& event);
+        void DrainPosted();
+        void ApplyPosted(const PostedUpdate& update);
+        uint32_t& FindPostSlot(const void* target, MD3AnimationType type);
+        size_t AdvancePhaseClocks(float deltaTime);
+        bool IsPhaseClockLive(size_t index) const;
+        int GetPhaseStepWait() const;
+        void RemovePhaseSubscriber(MD3PhaseClock clock, uint32_t group);
+        bool HasPhaseSubscriptions(const Owner& owner) const;
+        void RunFrame();
+        uint32_t AcquireOwner(wxWindow* window);
+        void CancelGroup(uint32_t group);
+        void DetachOwner(MD3Animation& animation);
+        void OnOwnerDestroy(wxWindowDestroyEvent& event);
+        void CompactAnimations();
+        void UpdateShedding(float load);
+        void SetShedLevel(int level);
+        void ApplyUpdateIntervals();
+        int GetActiveFrameInterval() const;
+        bool ShouldUpdate(MD3Animation& animation, size_t index, float deltaTime);
+        void UpdateCulling();
+        void QueueRepaint(wxWindow* window, const wxRect* rect);
+        uint32_t& FindDirtySlot(wxWindow* window);
+        size_t FlushRepaints();
         static std::unique_ptr<MD3Animator> s_instance;
     };
 
@@ -206,6 +531,197 @@ namespace wx_md3 {
         return animation;
     }
 
+    template<typename T>
+    MD3AnimationHandle MD3Animator::AnimateProperty(
+        MD3AnimationType type, T* target, T endValue,
+        long duration, MD3Easing easing, wxWindow* owner) {
+        static_assert(MD3TrackTraits<T>::batched,
+                      "AnimateProperty takes float, int, wxColour or wxRealPoint; use CreatePropertyAnimation for other types");
+        MD3TrackId track = m_tracks.Retarget(type, target, endValue, duration, easing);
+        if (!track.IsNull()) {
+            m_stats.retargets++;
+        } else {
+            track = m_tracks.Add(type, target, *target, endValue, duration, easing);
+        }
+        if (owner) {
+            SetTrackOwner(track, owner);
+        }
+        if (m_tracks.GetState(track) != MD3AnimationState::Playing) {
+            m_tracks.Start(track);
+        }
+        Wake();
+        return MD3AnimationHandle(track);
+    }
+
+    // Posted payloads (MD3AnimationValue) per property type
+    inline MD3AnimationValue MD3MakePostValue(float value) { return MD3AnimationValue(value); }
+    inline MD3AnimationValue MD3MakePostValue(int value) { return MD3AnimationValue(value); }
+    inline MD3AnimationValue MD3MakePostValue(const wxColour& value) {
+        return MD3AnimationValue(value.Red(), value.Green(), value.Blue(), value.Alpha());
+    }
+    inline MD3AnimationValue MD3MakePostValue(const wxRealPoint& value) {
+        return MD3AnimationValue(static_cast<float>(value.x), static_cast<float>(value.y));
+    }
+
+    template<typename T>
+    bool MD3Animator::PostProperty(MD3AnimationType type, T* target, const T& value,
+                                   long duration, MD3Easing easing, wxWindow* owner) {
+        static_assert(MD3TrackTraits<T>::batched,
+                      "PostProperty takes float, int, wxColour or wxRealPoint");
+        if (!target) return false;
+        PostedUpdate update;
+        update.target = target;
+        update.owner = owner;
+        update.duration = duration;
+        update.type = type;
+        update.easing = easing;
+        update.value = MD3MakePostValue(value);
+        return Post(update);
+    }
+
+    template<typename T>
+    MD3AnimationHandle MD3Animator::PlayProperty(
+        MD3AnimationType type, T* target, T startValue, T endValue,
+        long duration, MD3Easing easing, wxWindow* owner) {
+        static_assert(MD3TrackTraits<T>::batched,
+                      "PlayProperty takes float, int, wxColour or wxRealPoint; use CreatePropertyAnimation for other types");
+        MD3TrackId track = m_tracks.Play(type, target, startValue, endValue, duration, easing);
+        if (owner) {
+            SetTrackOwner(track, owner);
+        }
+        Wake();
+        return MD3AnimationHandle(track);
+    }
+
+    // Template implementation for MD3PropertyAnimation
+    template<typename T>
+    void MD3PropertyAnimation<T>::Update(float deltaTime) {
+        if constexpr (!MD3TrackTraits<T>::batched) {
+            if (m_state != MD3AnimationState::Playing) return;
+
+            m_elapsedTime += deltaTime;
+            if (m_elapsedTime >= static_cast<float>(m_duration)) {
+                if (m_target) *m_target = m_endValue;
+                m_state = MD3AnimationState::Completed;
+                if (m_onComplete) m_onComplete();
+                return;
+            }
+
+            float t = Ease(m_elapsedTime / static_cast<float>(m_duration), m_easing);
+            if (m_target) *m_target = static_cast<T>(m_startValue + (m_endValue - m_startValue) * t);
+            if (m_onUpdate) m_onUpdate();
+        }
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::CreateTrack() {
+        if constexpr (MD3TrackTraits<T>::batched) {
+            MD3TrackEngine& tracks = MD3Animator::GetInstance().GetTrackEngine();
+            m_track = tracks.Add(m_type, m_target, m_startValue, m_endValue, m_duration, m_easing);
+            tracks.SetOnStartCallback(m_track, m_onStart);
+            tracks.SetOnUpdateCallback(m_track, m_onUpdate);
+            tracks.SetOnCompleteCallback(m_track, m_onComplete);
+            if (m_owner) {
+                MD3Animator::GetInstance().SetTrackOwner(m_track, m_owner);
+            }
+            tracks.SetPriority(m_track, m_priority);
+        }
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::Attach() {
+        if (m_attached || !MD3TrackTraits<T>::batched) return;
+        m_attached = true;
+        CreateTrack();
+
+        // Honour a Start() issued before the animation was added
+        if (m_state == MD3AnimationState::Playing) {
+            MD3Animator::GetInstance().GetTrackEngine().Start(m_track);
+        }
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::Detach() {
+        if (m_attached) {
+            MD3Animator::GetInstance().GetTrackEngine().Remove(m_track);
+            m_attached = false;
+        }
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::Start() {
+        if (!m_attached) {
+            MD3Animation::Start();
+            return;
+        }
+
+        MD3TrackEngine& tracks = MD3Animator::GetInstance().GetTrackEngine();
+        if (!tracks.IsAlive(m_track)) {
+            // The finished track was compacted away; replay it from the stored parameters
+            CreateTrack();
+        }
+        tracks.Start(m_track);
+        MD3Animator::GetInstance().Wake();
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::Stop() {
+        if (m_attached) MD3Animator::GetInstance().GetTrackEngine().Stop(m_track);
+        else MD3Animation::Stop();
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::Pause() {
+        if (m_attached) MD3Animator::GetInstance().GetTrackEngine().Pause(m_track);
+        else MD3Animation::Pause();
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::Resume() {
+        if (!m_attached) {
+            MD3Animation::Resume();
+            return;
+        }
+        MD3Animator::GetInstance().GetTrackEngine().Resume(m_track);
+        MD3Animator::GetInstance().Wake();
+    }
+
+    template<typename T>
+    MD3AnimationState MD3PropertyAnimation<T>::GetState() const {
+        if (!m_attached) return m_state;
+        return MD3Animator::GetInstance().GetTrackEngine().GetState(m_track);
+    }
+
+    template<typename T>
+    long MD3PropertyAnimation<T>::GetElapsedTime() const {
+        if (!m_attached) return static_cast<long>(m_elapsedTime);
+        return static_cast<long>(MD3Animator::GetInstance().GetTrackEngine().GetElapsedTime(m_track));
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::SetPriority(MD3AnimationPriority priority) {
+        m_priority = priority;
+        if (m_attached) MD3Animator::GetInstance().GetTrackEngine().SetPriority(m_track, priority);
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::SetOnStartCallback(AnimationCallback callback) {
+        m_onStart = callback;
+        if (m_attached) MD3Animator::GetInstance().GetTrackEngine().SetOnStartCallback(m_track, callback);
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::SetOnUpdateCallback(AnimationCallback callback) {
+        m_onUpdate = callback;
+        if (m_attached) MD3Animator::GetInstance().GetTrackEngine().SetOnUpdateCallback(m_track, callback);
+    }
+
+    template<typename T>
+    void MD3PropertyAnimation<T>::SetOnCompleteCallback(AnimationCallback callback) {
+        m_onComplete = callback;
+        if (m_attached) MD3Animator::GetInstance().GetTrackEngine().SetOnCompleteCallback(m_track, callback);
+    }
+
 } // namespace wx_md3
 
 #endif // MD3ANIMATOR_H
\ No newline at end of file
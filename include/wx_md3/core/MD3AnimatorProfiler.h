@@ -0,0 +1,70 @@
+#ifndef MD3ANIMATORPROFILER_H
+#define MD3ANIMATORPROFILER_H
+
+#include <wx/string.h>
+#include <cstdint>
+#include <vector>
+
+namespace wx_md3 {
+
+    // One animator frame as seen by the profiler (times in ms on the steady clock)
+    struct MD3FrameSample {
+        double frameStart = 0.0;      // When the timer event was handled
+        float frameDuration = 0.0f;   // Whole OnTimer cost
+        float updateTime = 0.0f;      // Advancing tracks and custom animations
+        float paintTime = 0.0f;       // Flushing the coalesced repaints
+        float interval = 0.0f;        // Time since the previous frame (or since the timer was armed)
+        float timerLateness = 0.0f;   // interval minus the requested timer interval
+        uint32_t activeTracks = 0;    // Tracks and custom animations alive at the start of the frame
+        uint32_t repaints = 0;        // Windows repainted by this frame
+        uint32_t shedLevel = 0;       // Load-shedding level in effect (see MD3Animator::SetFrameBudget)
+    };
+
+    // Percentiles of one frame metric (ms)
+    struct MD3PercentileSummary {
+        float p50 = 0.0f;
+        float p95 = 0.0f;
+        float p99 = 0.0f;
+        float max = 0.0f;
+        float mean = 0.0f;
+    };
+
+    struct MD3FrameTimeSummary {
+        size_t frames = 0;
+        MD3PercentileSummary frameTime;   // frameDuration
+        MD3PercentileSummary interval;    // Frame-to-frame interval
+        MD3PercentileSummary lateness;    // Timer lateness
+    };
+
+    // Opt-in animator profiler: a fixed-size ring buffer of frame samples that can be
+    // summarised or exported as Chrome trace / Perfetto JSON. Enable it with
+    // MD3Animator::EnableProfiler(); when disabled the animator only tests a pointer per frame.
+    class MD3AnimatorProfiler {
+    public:
+        explicit MD3AnimatorProfiler(size_t capacity = 1024);
+
+        // Record a frame (overwrites the oldest sample once the buffer is full)
+        void Record(const MD3FrameSample& sample);
+        void Clear();
+
+        // Samples currently held, oldest first
+        size_t GetSampleCount() const { return m_count; }
+        size_t GetCapacity() const { return m_samples.size(); }
+        const MD3FrameSample& GetSample(size_t index) const;
+
+        // p50/p95/p99 of frame time, interval and timer lateness over the held samples
+        MD3FrameTimeSummary Summarize() const;
+
+        // Chrome trace event JSON (load in chrome://tracing or ui.perfetto.dev)
+        wxString ExportChromeTrace() const;
+        bool SaveChromeTrace(const wxString& path) const;
+
+    private:
+        std::vector<MD3FrameSample> m_samples;
+        size_t m_next;
+        size_t m_count;
+    };
+
+} // namespace wx_md3
+
+#endif // MD3ANIMATORPROFILER_H
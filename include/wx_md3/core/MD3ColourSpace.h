@@ -0,0 +1,36 @@
+#ifndef MD3COLOURSPACE_H
+#define MD3COLOURSPACE_H
+
+#include <wx/colour.h>
+#include <cstddef>
+
+namespace wx_md3 {
+
+    // Colour in linear light with premultiplied alpha, channels in [0, 1]. Colour tracks
+    // and MD3Animator::LerpColour interpolate in this space: midpoints keep their
+    // brightness, and fading to or from a transparent colour does not pass through its
+    // (meaningless) RGB, so there are no dark fringes.
+    struct MD3LinearColour {
+        float r, g, b, a;
+    };
+
+    // sRGB transfer function per 8-bit channel (table lookups)
+    float MD3SrgbToLinear(unsigned char value);
+    unsigned char MD3LinearToSrgb(float value);
+
+    MD3LinearColour MD3ToLinearColour(const wxColour& colour);
+    wxColour MD3FromLinearColour(const MD3LinearColour& colour);
+
+    // Straight (un-premultiplied) linear channels to sRGB; zero alpha gives transparent black
+    wxColour MD3FromStraightLinear(float r, float g, float b, float a);
+
+    // Batched interpolation over planar colours (plane 0..3 = r, g, b, a, premultiplied):
+    // out = start + (end - start) * t[i] per channel, then un-premultiplied, so the
+    // planes of out hold straight-alpha linear channels ready for MD3FromStraightLinear.
+    // Uses the best SIMD kernel (see MD3Simd.h) and matches the scalar path.
+    void MD3LerpColourPlanes(const float* const start[4], const float* const end[4], const float* t,
+                             float* const out[4], size_t count);
+
+} // namespace wx_md3
+
+#endif // MD3COLOURSPACE_H
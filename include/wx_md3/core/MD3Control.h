@@ -5,7 +5,9 @@
 #include <wx/window.h>
 #include <wx/dc.h>
 #include <array>
+#include <vector>
 #include "wx_md3/core/MD3Animator.h"
+#include "wx_md3/core/MD3Theme.h"
 
 namespace wx_md3 {
 
@@ -19,6 +21,17 @@ namespace wx_md3 {
         Error
     };
 
+    // Row of MD3Theme::GetStateColor for a control state
+    inline MD3ColorState MD3ToColorState(MD3State state) {
+        switch (state) {
+            case MD3State::Hover:    return MD3ColorState::Hovered;
+            case MD3State::Pressed:  return MD3ColorState::Pressed;
+            case MD3State::Disabled: return MD3ColorState::Disabled;
+            case MD3State::Focused:  return MD3ColorState::Focused;
+            default:                 return MD3ColorState::Enabled;
+        }
+    }
+
     // MD3 Control Base Class
     class MD3Control : public wxWindow {
         DECLARE_DYNAMIC_CLASS(MD3Control)
@@ -45,6 +58,15 @@ namespace wx_md3 {
         virtual void SetTheme(const wxString& theme);
         wxString GetTheme() const { return m_theme; }
 
+        // Theme change propagation. Every live control sits in a dense registry and keeps its
+        // own slot, so construction and destruction are O(1). NotifyThemeChanged (called by
+        // MD3Theme when the current theme changes) runs each control's UpdateAppearance once,
+        // then sends wxEVT_MD3_THEME_CHANGED to and refreshes each top-level window holding
+        // controls once, so all of them repaint in one batch. UI thread only; UpdateAppearance
+        // must not destroy controls.
+        static void NotifyThemeChanged();
+        static size_t GetRegisteredControlCount() { return s_controls.size(); }
+
         // Animation Support
         virtual void StartAnimation(MD3AnimationType animationType);
         virtual void StopAnimation(MD3AnimationType animationType);
@@ -77,11 +99,15 @@ namespace wx_md3 {
 
         // Internal Methods
         virtual void UpdateState();
+        virtual void UpdateAppearance();   // Re-read theme colours (also on theme changes)
         virtual void Render(wxDC& dc); // Virtual function with default implementation
 
     private:
         void Init();
 
+        size_t m_registrySlot;   // Index in s_controls
+        static std::vector<MD3Control*> s_controls;
+
         wxDECLARE_EVENT_TABLE();
     };
 
@@ -0,0 +1,104 @@
+#ifndef MD3CUBICBEZIER_H
+#define MD3CUBICBEZIER_H
+
+#include <cstddef>
+#include "wx_md3/core/MD3AnimationTypes.h"
+
+namespace wx_md3 {
+
+    // CSS-style cubic-bezier(x1, y1, x2, y2) easing curve.
+    // The curve is compiled once into a lookup table of the bezier parameter t sampled at
+    // evenly spaced x; Evaluate() interpolates the table and sharpens the guess with a
+    // Newton step, instead of solving x(t) = x from scratch on every frame.
+    // Construction is constexpr, so fixed curves (the MD3 spec ones) are built at compile time.
+    class MD3CubicBezier {
+    public:
+        static constexpr size_t kTableSize = 257;  // t sampled at x = i / 256
+
+        constexpr MD3CubicBezier(float x1, float y1, float x2, float y2);
+
+        // Eased value for progress x in [0, 1] (LUT + Newton refinement)
+        float Evaluate(float x) const;
+        void EvaluateBatch(const float* progress, float* out, size_t count) const;
+
+        // Reference solver: Newton iterations with bisection fallback (no table)
+        float Solve(float x) const;
+
+        float GetX1() const { return m_x1; }
+        float GetY1() const { return m_y1; }
+        float GetX2() const { return m_x2; }
+        float GetY2() const { return m_y2; }
+
+        // Register a user-defined curve and get the easing id that selects it.
+        // Identical parameters share one curve; x1 and x2 are clamped to [0, 1].
+        static MD3Easing Register(float x1, float y1, float x2, float y2);
+
+        // Curve behind an easing id (MD3 spec curves and registered ones), or nullptr
+        // for the polynomial presets
+        static const MD3CubicBezier* Find(MD3Easing easing);
+
+    private:
+        // Polynomial coefficients: x(t) = ((ax t + bx) t + cx) t, same for y
+        float m_ax, m_bx, m_cx;
+        float m_ay, m_by, m_cy;
+        float m_x1, m_y1, m_x2, m_y2;
+        float m_table[kTableSize];
+
+        float SampleX(float t) const { return ((m_ax * t + m_bx) * t + m_cx) * t; }
+        float SampleY(float t) const { return ((m_ay * t + m_by) * t + m_cy) * t; }
+        float SampleSlopeX(float t) const { return (3.0f * m_ax * t + 2.0f * m_bx) * t + m_cx; }
+
+        // Compile-time solve of x(t) = x in double precision (used to build the table)
+        static constexpr double SolveT(double ax, double bx, double cx, double x);
+    };
+
+    constexpr double MD3CubicBezier::SolveT(double ax, double bx, double cx, double x) {
+        // Newton from t = x converges quickly for well-behaved curves
+        double t = x;
+        for (int i = 0; i < 8; ++i) {
+            double error = ((ax * t + bx) * t + cx) * t - x;
+            if (error < 1e-12 && error > -1e-12) return t;
+            double slope = (3.0 * ax * t + 2.0 * bx) * t + cx;
+            if (slope < 1e-9 && slope > -1e-9) break;
+            t -= error / slope;
+        }
+
+        // Flat spots: fall back to bisection (x(t) is monotonic for x1, x2 in [0, 1])
+        double lo = 0.0;
+        double hi = 1.0;
+        t = x;
+        for (int i = 0; i < 64; ++i) {
+            double value = ((ax * t + bx) * t + cx) * t;
+            if (value < x) lo = t;
+            else hi = t;
+            t = (lo + hi) * 0.5;
+        }
+        return t;
+    }
+
+    constexpr MD3CubicBezier::MD3CubicBezier(float x1, float y1, float x2, float y2)
+        : m_ax(0.0f), m_bx(0.0f), m_cx(0.0f), m_ay(0.0f), m_by(0.0f), m_cy(0.0f),
+          m_x1(x1), m_y1(y1), m_x2(x2), m_y2(y2), m_table() {
+        double cx = 3.0 * x1;
+        double bx = 3.0 * (x2 - x1) - cx;
+        double ax = 1.0 - cx - bx;
+        double cy = 3.0 * y1;
+        double by = 3.0 * (y2 - y1) - cy;
+        double ay = 1.0 - cy - by;
+
+        m_ax = static_cast<float>(ax);
+        m_bx = static_cast<float>(bx);
+        m_cx = static_cast<float>(cx);
+        m_ay = static_cast<float>(ay);
+        m_by = static_cast<float>(by);
+        m_cy = static_cast<float>(cy);
+
+        for (size_t i = 0; i < kTableSize; ++i) {
+            double x = static_cast<double>(i) / static_cast<double>(kTableSize - 1);
+            m_table[i] = static_cast<float>(SolveT(ax, bx, cx, x));
+        }
+    }
+
+} // namespace wx_md3
+
+#endif // MD3CUBICBEZIER_H
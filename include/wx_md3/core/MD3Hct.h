@@ -0,0 +1,64 @@
+#ifndef MD3HCT_H
+#define MD3HCT_H
+
+#include <wx/colour.h>
+#include <cstdint>
+#include <memory>
+
+namespace wx_md3 {
+
+    // HCT colour (Material You): CAM16 hue and chroma with CIE L* as tone, under the
+    // default MD3 viewing conditions (D65, 200/pi * Y(50) lux, average surround). Tone is
+    // perceptual lightness, so equal tones of different hues contrast alike.
+    struct MD3Hct {
+        double hue = 0.0;       // Degrees [0, 360)
+        double chroma = 0.0;    // >= 0; the reachable maximum depends on hue and tone
+        double tone = 0.0;      // L* [0, 100]
+
+        static MD3Hct FromColour(const wxColour& colour);
+
+        // Nearest sRGB colour: hue and tone are kept, chroma is reduced to the gamut boundary
+        // when the requested one cannot be displayed
+        wxColour ToColour() const;
+    };
+
+    wxColour MD3HctToColour(double hue, double chroma, double tone);
+
+    // Tones of one hue and chroma. The 13 standard tones (0, 10, ..., 90, 95, 99, 100) are
+    // solved once on construction; other tones are solved on demand.
+    class MD3TonalPalette {
+    public:
+        static constexpr int kToneCount = 13;
+        static const int kTones[kToneCount];
+
+        MD3TonalPalette() = default;
+        MD3TonalPalette(double hue, double chroma);
+
+        wxColour GetTone(int tone) const;
+        double GetHue() const { return m_hue; }
+        double GetChroma() const { return m_chroma; }
+
+    private:
+        double m_hue = 0.0;
+        double m_chroma = 0.0;
+        uint32_t m_standard[kToneCount] = {};   // 0xRRGGBB per kTones entry
+    };
+
+    // The five key palettes of a seed colour (Material You "tonal spot") plus the error
+    // palette. Get() memoises per seed RGB, so regenerating a scheme for a seed seen
+    // before costs only table reads; it is safe to call from any thread.
+    struct MD3CorePalette {
+        MD3TonalPalette primary;
+        MD3TonalPalette secondary;
+        MD3TonalPalette tertiary;
+        MD3TonalPalette neutral;
+        MD3TonalPalette neutralVariant;
+        MD3TonalPalette error;
+
+        explicit MD3CorePalette(const wxColour& seed);
+        static std::shared_ptr<const MD3CorePalette> Get(const wxColour& seed);
+    };
+
+} // namespace wx_md3
+
+#endif // MD3HCT_H
@@ -0,0 +1,122 @@
+#ifndef MD3INPLACEFUNCTION_H
+#define MD3INPLACEFUNCTION_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace wx_md3 {
+
+    // Callable wrapper with fixed inline storage: never allocates, so copying
+    // callbacks around the animation loop is as cheap as copying a few words.
+    // Callables larger than Capacity are rejected at compile time.
+    template<typename Signature, size_t Capacity = 32>
+    class MD3InplaceFunction;
+
+    template<typename R, typename... Args, size_t Capacity>
+    class MD3InplaceFunction<R(Args...), Capacity> {
+    public:
+        MD3InplaceFunction() noexcept : m_ops(nullptr) {}
+        MD3InplaceFunction(std::nullptr_t) noexcept : m_ops(nullptr) {}
+
+        template<typename F, typename Fn = typename std::decay<F>::type,
+                 typename = typename std::enable_if<!std::is_same<Fn, MD3InplaceFunction>::value>::type>
+        MD3InplaceFunction(F&& f) : m_ops(nullptr) {
+            static_assert(sizeof(Fn) <= Capacity, "Callable too large for MD3InplaceFunction storage");
+            static_assert(alignof(Fn) <= alignof(std::max_align_t), "Callable over-aligned for MD3InplaceFunction");
+            if (IsEmpty(f)) return;
+            new (m_storage) Fn(std::forward<F>(f));
+            m_ops = &OpsFor<Fn>::table;
+        }
+
+        MD3InplaceFunction(const MD3InplaceFunction& other) : m_ops(other.m_ops) {
+            if (m_ops) m_ops->copy(m_storage, other.m_storage);
+        }
+
+        MD3InplaceFunction(MD3InplaceFunction&& other) noexcept : m_ops(other.m_ops) {
+            if (m_ops) {
+                m_ops->move(m_storage, other.m_storage);
+                other.Reset();
+            }
+        }
+
+        ~MD3InplaceFunction() { Reset(); }
+
+        MD3InplaceFunction& operator=(const MD3InplaceFunction& other) {
+            if (this != &other) {
+                Reset();
+                if (other.m_ops) {
+                    other.m_ops->copy(m_storage, other.m_storage);
+                    m_ops = other.m_ops;
+                }
+            }
+            return *this;
+        }
+
+        MD3InplaceFunction& operator=(MD3InplaceFunction&& other) noexcept {
+            if (this != &other) {
+                Reset();
+                if (other.m_ops) {
+                    other.m_ops->move(m_storage, other.m_storage);
+                    m_ops = other.m_ops;
+                    other.Reset();
+                }
+            }
+            return *this;
+        }
+
+        MD3InplaceFunction& operator=(std::nullptr_t) noexcept {
+            Reset();
+            return *this;
+        }
+
+        explicit operator bool() const noexcept { return m_ops != nullptr; }
+
+        R operator()(Args... args) const {
+            return m_ops->invoke(const_cast<unsigned char*>(m_storage), std::forward<Args>(args)...);
+        }
+
+    private:
+        struct Ops {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*copy)(void* dst, const void* src);
+            void (*move)(void* dst, void* src);
+            void (*destroy)(void* storage);
+        };
+
+        template<typename Fn>
+        struct OpsFor {
+            static R Invoke(void* storage, Args&&... args) {
+                return (*static_cast<Fn*>(storage))(std::forward<Args>(args)...);
+            }
+            static void Copy(void* dst, const void* src) { new (dst) Fn(*static_cast<const Fn*>(src)); }
+            static void Move(void* dst, void* src) { new (dst) Fn(std::move(*static_cast<Fn*>(src))); }
+            static void Destroy(void* storage) { static_cast<Fn*>(storage)->~Fn(); }
+
+            static constexpr Ops table = { &Invoke, &Copy, &Move, &Destroy };
+        };
+
+        // Empty std::function objects and null function pointers stay empty
+        template<typename F> static bool IsEmpty(const F&) { return false; }
+        template<typename S> static bool IsEmpty(const std::function<S>& f) { return !f; }
+        template<typename P> static bool IsEmpty(P* p) { return p == nullptr; }
+
+        void Reset() noexcept {
+            if (m_ops) {
+                m_ops->destroy(m_storage);
+                m_ops = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char m_storage[Capacity];
+        const Ops* m_ops;
+    };
+
+    // Callback type used by animations and the track engine
+    using MD3Callback = MD3InplaceFunction<void()>;
+
+} // namespace wx_md3
+
+#endif // MD3INPLACEFUNCTION_H
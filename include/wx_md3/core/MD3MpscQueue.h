@@ -0,0 +1,85 @@
+#ifndef MD3MPSCQUEUE_H
+#define MD3MPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace wx_md3 {
+
+    // Bounded lock-free multi-producer / single-consumer queue. Each cell carries a
+    // sequence number: producers claim a position with one CAS and publish the value by
+    // bumping the cell's sequence, the consumer reads cells in position order, so items
+    // come out in the order their positions were claimed. Never allocates after
+    // construction; TryPush fails (instead of blocking) when the queue is full.
+    template<typename T>
+    class MD3MpscQueue {
+    public:
+        // capacity is rounded up to a power of two
+        explicit MD3MpscQueue(size_t capacity)
+            : m_mask(RoundUp(capacity) - 1), m_cells(new Cell[m_mask + 1]), m_enqueuePos(0), m_dequeuePos(0) {
+            for (size_t i = 0; i <= m_mask; ++i) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MD3MpscQueue(const MD3MpscQueue&) = delete;
+        MD3MpscQueue& operator=(const MD3MpscQueue&) = delete;
+
+        // Any thread
+        bool TryPush(const T& value) {
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+            for (;;) {
+                cell = &m_cells[pos & m_mask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                if (diff == 0) {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                } else if (diff < 0) {
+                    return false;   // Full: the consumer has not freed this cell yet
+                } else {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->value = value;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer thread only
+        bool TryPop(T& value) {
+            Cell& cell = m_cells[m_dequeuePos & m_mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence != m_dequeuePos + 1) return false;   // Empty, or the next push is unfinished
+
+            value = cell.value;
+            cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+            m_dequeuePos++;
+            return true;
+        }
+
+        size_t GetCapacity() const { return m_mask + 1; }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        static size_t RoundUp(size_t capacity) {
+            size_t size = 2;
+            while (size < capacity) size <<= 1;
+            return size;
+        }
+
+        const size_t m_mask;
+        std::unique_ptr<Cell[]> m_cells;
+        alignas(64) std::atomic<size_t> m_enqueuePos;   // Own cache lines: producers and the
+        alignas(64) size_t m_dequeuePos;                // consumer do not false-share
+    };
+
+} // namespace wx_md3
+
+#endif // MD3MPSCQUEUE_H
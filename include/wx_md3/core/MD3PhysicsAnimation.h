@@ -0,0 +1,123 @@
+#ifndef MD3PHYSICSANIMATION_H
+#define MD3PHYSICSANIMATION_H
+
+#include "wx_md3/core/MD3Animator.h"
+
+namespace wx_md3 {
+
+    // Spring animation: drives *target towards a final value with a damped harmonic
+    // oscillator. Position and velocity are evaluated in closed form from the time since
+    // the last (re)start, so the cost per frame is constant and the result does not depend
+    // on the frame rate. Retargeting keeps the current position and velocity.
+    class MD3SpringAnimation : public MD3Animation {
+    public:
+        // Stiffness presets (1/s^2)
+        static constexpr float StiffnessHigh = 10000.0f;
+        static constexpr float StiffnessMedium = 1500.0f;
+        static constexpr float StiffnessMediumLow = 400.0f;
+        static constexpr float StiffnessLow = 200.0f;
+
+        // Damping ratio presets (1 = critically damped, no overshoot)
+        static constexpr float DampingNoBouncy = 1.0f;
+        static constexpr float DampingLowBouncy = 0.75f;
+        static constexpr float DampingMediumBouncy = 0.5f;
+        static constexpr float DampingHighBouncy = 0.2f;
+
+        MD3SpringAnimation(float* target, float finalValue,
+                           float stiffness = StiffnessMedium, float dampingRatio = DampingNoBouncy,
+                           MD3AnimationType type = MD3AnimationType::Custom);
+
+        // Starts from the current value of *target with the configured start velocity
+        void Start() override;
+        void Update(float deltaTime) override;
+        bool IsCompleted() const override { return m_state == MD3AnimationState::Completed; }
+
+        // Move the rest position; a running spring continues from its current position
+        // and velocity instead of restarting from a standstill
+        void SetFinalValue(float finalValue);
+        float GetFinalValue() const { return m_finalValue; }
+
+        // Damping ratios below 0.01 are raised to it: an undamped spring never settles
+        void SetStiffness(float stiffness);
+        void SetDampingRatio(float dampingRatio);
+
+        // Velocity (units per second) used by the next Start()
+        void SetStartVelocity(float velocity) { m_startVelocity = velocity; }
+
+        // Current velocity in units per second
+        float GetVelocity() const { return m_velocity; }
+
+        // The spring settles (snaps to the final value and completes) once both the
+        // displacement and the velocity fall below these thresholds
+        void SetSettleThresholds(float displacement, float velocity);
+
+    protected:
+        void Settle() override;
+
+    private:
+        float* m_target;
+        float m_finalValue;
+        float m_stiffness;
+        float m_dampingRatio;
+        float m_startVelocity;
+        float m_displacementThreshold;
+        float m_velocityThreshold;
+
+        // Motion segment: displacement/velocity at the anchor and time since it (s)
+        float m_anchorDisplacement;
+        float m_anchorVelocity;
+        float m_segmentTime;
+        float m_velocity;
+
+        void Anchor(float position, float velocity);
+        void Evaluate(float time, float& displacement, float& velocity) const;
+        void Finish();
+    };
+
+    // Fling animation: *target coasts with an exponentially decaying velocity,
+    // v(t) = v0 e^(-friction t), optionally stopping at a bound. Closed-form like the spring.
+    class MD3FlingAnimation : public MD3Animation {
+    public:
+        MD3FlingAnimation(float* target, float startVelocity, float friction = 4.2f,
+                          MD3AnimationType type = MD3AnimationType::Custom);
+
+        void Start() override;
+        void Update(float deltaTime) override;
+        bool IsCompleted() const override { return m_state == MD3AnimationState::Completed; }
+
+        // Velocity (units per second) used by the next Start()
+        void SetStartVelocity(float velocity) { m_startVelocity = velocity; }
+        void SetFriction(float friction);
+
+        // Stop early when the value reaches either bound
+        void SetBounds(float minValue, float maxValue);
+
+        // Completes once |velocity| falls below this (units per second, default 1)
+        void SetSettleThreshold(float velocity) { m_velocityThreshold = velocity; }
+
+        float GetVelocity() const { return m_velocity; }
+
+        // Where the fling will come to rest (ignoring bounds)
+        float GetRestingValue() const;
+
+    protected:
+        // Comes to rest where the fling would have, within the bounds
+        void Settle() override;
+
+    private:
+        float* m_target;
+        float m_startVelocity;
+        float m_friction;
+        float m_minValue;
+        float m_maxValue;
+        float m_velocityThreshold;
+        float m_startValue;
+        float m_time;
+        float m_velocity;
+
+        void Finish(float value);
+    };
+
+} // namespace wx_md3
+
+#endif // MD3PHYSICSANIMATION_H
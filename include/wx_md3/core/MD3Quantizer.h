@@ -0,0 +1,71 @@
+#ifndef MD3QUANTIZER_H
+#define MD3QUANTIZER_H
+
+#include <wx/colour.h>
+#include <wx/image.h>
+#include <wx/event.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace wx_md3 {
+
+    // Seed used when an image has no colour suitable for a theme (Google blue, as on Android)
+    const wxColour kMD3FallbackSeedColor(66, 133, 244);
+
+    struct MD3QuantizerOptions {
+        int maxSampleSize = 128;     // Longer side of the area-averaged sample grid
+        int maxColors = 128;         // Wu boxes, i.e. k-means clusters
+        int maxIterations = 10;      // k-means rounds (stops early once assignments settle)
+    };
+
+    // A quantized colour and how many sample cells it stands for
+    struct MD3QuantizedColor {
+        wxColour colour;
+        uint32_t population = 0;
+    };
+
+    // A quantized colour ranked for use as a theme seed
+    struct MD3SeedCandidate {
+        wxColour colour;
+        uint32_t population = 0;
+        double score = 0.0;
+    };
+
+    // Image -> dominant colours: the image is area-averaged onto at most maxSampleSize
+    // cells per side (non-opaque pixels are ignored), Wu's quantizer splits the sample's
+    // RGB histogram into maxColors boxes, and weighted k-means in CIELAB refines their
+    // centres. Sorted by population, largest first. Only reads the image's pixel buffer,
+    // so it may run on any thread as long as nobody writes the image meanwhile.
+    std::vector<MD3QuantizedColor> MD3QuantizeImage(const wxImage& image,
+                                                    const MD3QuantizerOptions& options = MD3QuantizerOptions());
+
+    // Material You seed scoring: colours are ranked by how much of the image their hue
+    // neighbourhood covers and by chroma (48 is ideal), near-greys and rare hues are
+    // dropped, and picks differ in hue by as many degrees as still yields `desired`
+    // candidates. Empty when nothing qualifies.
+    std::vector<MD3SeedCandidate> MD3ScoreSeedColors(const std::vector<MD3QuantizedColor>& colors,
+                                                     size_t desired = 4);
+
+    // Best seed of an image, or fallback. Also warms the seed's palette memo (MD3Hct.h), so
+    // a following MD3Theme::SetSeedColor only reads tones.
+    wxColour MD3ExtractSeedColor(const wxImage& image, const wxColour& fallback = kMD3FallbackSeedColor,
+                                 const MD3QuantizerOptions& options = MD3QuantizerOptions());
+
+    // MD3ExtractSeedColor on a worker thread. The UI thread only takes a reference to the
+    // image; onSeed runs later on the UI thread, and is skipped if owner (when given) has
+    // been destroyed by then. Do not write to the image's pixels until onSeed has run.
+    void MD3ExtractSeedColorAsync(const wxImage& image, wxEvtHandler* owner,
+                                  std::function<void(const wxColour&)> onSeed,
+                                  const wxColour& fallback = kMD3FallbackSeedColor);
+
+    // Batched nearest-centre search over planar points: for each point the index of the
+    // closest centre (squared Euclidean distance, lowest index on ties) and that distance.
+    // Uses the best SIMD kernel (see MD3Simd.h) and matches the scalar path.
+    void MD3FindNearestCentres(const float* const points[3], size_t count, const float* const centres[3],
+                               size_t centreCount, uint32_t* nearest, float* distance);
+
+} // namespace wx_md3
+
+#endif // MD3QUANTIZER_H
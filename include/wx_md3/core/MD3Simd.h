@@ -0,0 +1,26 @@
+#ifndef MD3SIMD_H
+#define MD3SIMD_H
+
+namespace wx_md3 {
+
+    // Instruction set used by the batched (SIMD) kernels
+    enum class MD3SimdLevel {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    // Best level supported by this CPU and build (detected once)
+    MD3SimdLevel MD3GetSupportedSimdLevel();
+
+    // Level currently used by the batched kernels; defaults to the supported level.
+    // MD3SetSimdLevel clamps the request to what the CPU supports (useful for benchmarks).
+    MD3SimdLevel MD3GetSimdLevel();
+    void MD3SetSimdLevel(MD3SimdLevel level);
+
+    // Human-readable name of a level
+    const char* MD3GetSimdLevelName(MD3SimdLevel level);
+
+} // namespace wx_md3
+
+#endif // MD3SIMD_H
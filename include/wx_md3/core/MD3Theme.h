@@ -4,8 +4,13 @@
 #include <wx/colour.h>
 #include <wx/string.h>
 #include <wx/window.h>
-#include <map>
+#include <wx/pen.h>
+#include <wx/brush.h>
+#include <wx/font.h>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
 
 namespace wx_md3 {
 
@@ -54,6 +59,84 @@ namespace wx_md3 {
         wxColour inversePrimary;
     };
 
+    // Colour roles of MD3ColorScheme, in declaration order. GetColor(MD3ColorRole) is a
+    // plain array index; prefer it over the string names in paint code.
+    enum class MD3ColorRole {
+        Primary,
+        OnPrimary,
+        PrimaryContainer,
+        OnPrimaryContainer,
+        Secondary,
+        OnSecondary,
+        SecondaryContainer,
+        OnSecondaryContainer,
+        Tertiary,
+        OnTertiary,
+        TertiaryContainer,
+        OnTertiaryContainer,
+        Error,
+        OnError,
+        ErrorContainer,
+        OnErrorContainer,
+        Background,
+        OnBackground,
+        Surface,
+        OnSurface,
+        SurfaceVariant,
+        OnSurfaceVariant,
+        Outline,
+        OutlineVariant,
+        Shadow,
+        Scrim,
+        SurfaceTint,
+        InverseSurface,
+        InverseOnSurface,
+        InversePrimary,
+        Count // Must be last
+    };
+
+    // Interaction states with precomputed colours (see MD3Theme::GetStateColor)
+    enum class MD3ColorState {
+        Enabled,
+        Hovered,    // State layer at 8%
+        Focused,    // 10%
+        Pressed,    // 10%
+        Dragged,    // 16%
+        Disabled,   // onSurface at 12% (containers) or 38% (content) over surface
+        Count // Must be last
+    };
+
+    // Role <-> name ("primary", "onSurfaceVariant", ...). The lookup is a perfect hash
+    // over the role names; returns false for an unknown name.
+    bool MD3FindColorRole(const char* name, MD3ColorRole* role);
+    bool MD3FindColorRole(const wxString& name, MD3ColorRole* role);
+    const char* MD3GetColorRoleName(MD3ColorRole role);
+
+    // Typography roles of the MD3 type scale that controls use (see MD3Theme::GetFont)
+    enum class MD3TypographyRole {
+        TitleLarge,
+        TitleMedium,
+        TitleSmall,
+        BodyLarge,
+        BodyMedium,     // Checkbox, radio button and switch labels
+        BodySmall,
+        LabelLarge,     // Button labels
+        LabelMedium,
+        LabelSmall,
+        Count // Must be last
+    };
+
+    // Hit/miss counters of a theme's pen, brush and font cache
+    struct MD3ThemeResourceStats {
+        uint64_t penHits = 0;
+        uint64_t penMisses = 0;
+        uint64_t brushHits = 0;
+        uint64_t brushMisses = 0;
+        uint64_t fontHits = 0;
+        uint64_t fontMisses = 0;
+        uint64_t flushes = 0;       // Cache dropped by a scheme change or by reaching its size cap
+    };
+
     // Theme type enum
     enum class MD3ThemeType {
         Light,
@@ -78,7 +161,20 @@ namespace wx_md3 {
         const MD3ColorScheme& GetColorScheme() const { return m_colorScheme; }
 
         // Get specific color
+        const wxColour& GetColor(MD3ColorRole role) const { return m_roleColors[static_cast<size_t>(role)]; }
+
+        // Role colour as it looks in a state, with the MD3 state layer (the matching "on"
+        // colour at the state's opacity) composited in, so it stays opaque for plain wxDC
+        // painting. Content roles (on*, outline, ...) only change when disabled. The whole
+        // table is rebuilt whenever the scheme changes.
+        const wxColour& GetStateColor(MD3ColorRole role, MD3ColorState state) const {
+            return m_stateColors[static_cast<size_t>(role)][static_cast<size_t>(state)];
+        }
+        static float GetStateLayerOpacity(MD3ColorState state);
+
+        // By name (compatibility): black and a warning for an unknown name
         wxColour GetColor(const wxString& colorName) const;
+        wxColour GetColor(const char* colorName) const;
 
         // Apply theme to window
         void ApplyToWindow(wxWindow* window) const;
@@ -87,11 +183,33 @@ namespace wx_md3 {
         static std::shared_ptr<MD3Theme> GetDefaultLightTheme();
         static std::shared_ptr<MD3Theme> GetDefaultDarkTheme();
         static std::shared_ptr<MD3Theme> GetCurrentTheme();
+        // Paint-time access without a shared_ptr copy; valid until the next SetCurrentTheme
+        static const MD3Theme& GetCurrent();
+        // Switching the current theme, or changing it (type, dynamic colors, seed), updates
+        // every MD3Control and repaints their windows (see MD3Control::NotifyThemeChanged)
         static void SetCurrentTheme(std::shared_ptr<MD3Theme> theme);
 
-        // Material You support (dynamic colors)
+        // Material You support (dynamic colors): the scheme is generated from the seed colour's
+        // HCT tonal palettes (see MD3Hct.h) for the current theme type. Palettes are memoised
+        // per seed, so switching back to a seed seen before only re-reads tones.
         void EnableDynamicColors(bool enable);
         bool IsDynamicColorsEnabled() const { return m_dynamicColors; }
+        // Sets the seed and enables dynamic colors
+        void SetSeedColor(const wxColour& seed);
+        const wxColour& GetSeedColor() const { return m_seedColor; }
+
+        // Shared GDI resources for painting, so Render does not construct a wxPen/wxBrush per
+        // call and controls do not each build their own fonts. Pens and brushes are keyed by
+        // colour (RGBA), width and style; fonts by typography role, derived from the system
+        // GUI font. The cache belongs to the theme, is dropped whenever its scheme changes
+        // and is flushed when it reaches kMaxCachedResources entries (animated colours).
+        // References stay valid until the next paint-time lookup may flush; copy if kept.
+        const wxPen& GetPen(const wxColour& colour, int width = 1, wxPenStyle style = wxPENSTYLE_SOLID) const;
+        const wxBrush& GetBrush(const wxColour& colour, wxBrushStyle style = wxBRUSHSTYLE_SOLID) const;
+        const wxFont& GetFont(MD3TypographyRole role) const;
+        void ClearResourceCache() const;
+        const MD3ThemeResourceStats& GetResourceStats() const { return m_resourceStats; }
+        static constexpr size_t kMaxCachedResources = 512;
 
         // Color conversion helper functions (public for external use)
         wxColour Lighten(const wxColour& color, double factor) const;
@@ -108,14 +226,22 @@ namespace wx_md3 {
         MD3ThemeType m_themeType;
         MD3ColorScheme m_colorScheme;
         bool m_dynamicColors;
+        wxColour m_seedColor;
 
         // Global current theme
         static std::shared_ptr<MD3Theme> s_currentTheme;
 
-        // Color map (for easy color access by name)
-        std::map<wxString, wxColour> m_colorMap;
-        bool m_colorMapBuilt;
-        void BuildColorMap();
+        // m_colorScheme indexed by MD3ColorRole, refreshed whenever the scheme changes
+        wxColour m_roleColors[static_cast<size_t>(MD3ColorRole::Count)];
+        wxColour m_stateColors[static_cast<size_t>(MD3ColorRole::Count)][static_cast<size_t>(MD3ColorState::Count)];
+        void SyncRoleColors();
+        void NotifyIfCurrent() const;
+
+        // Paint-time resource cache (mutable: filled through the const paint API)
+        mutable std::unordered_map<uint64_t, wxPen> m_pens;
+        mutable std::unordered_map<uint64_t, wxBrush> m_brushes;
+        mutable wxFont m_fonts[static_cast<size_t>(MD3TypographyRole::Count)];
+        mutable MD3ThemeResourceStats m_resourceStats;
     };
 
     // Theme change event
@@ -0,0 +1,140 @@
+#ifndef MD3TIMELINE_H
+#define MD3TIMELINE_H
+
+#include <initializer_list>
+#include <vector>
+#include <cstdint>
+#include "wx_md3/core/MD3Animator.h"
+
+namespace wx_md3 {
+
+    // One keyframe of a Keyframes() item: value reached at time (ms from the item start),
+    // approached with easing from the previous keyframe
+    struct MD3Keyframe {
+        long time;
+        float value;
+        MD3Easing easing = MD3Easing::Linear;
+    };
+
+    // Declarative composite motion: tweens and keyframes arranged in nested sequence and
+    // parallel groups, with delays, staggering and repeat. Building resolves every item to
+    // absolute start/end times in a single pass; Compile() then sorts the result into one
+    // flat, time-ordered segment array per animated property, so playback is one binary
+    // search per property per frame and never allocates.
+    //
+    //     MD3Timeline timeline;
+    //     timeline.BeginParallel()
+    //                 .Tween(&m_scale, 0.0f, 1.0f, 200, MD3Easing::EmphasizedDecelerate)
+    //                 .Tween(&m_opacity, 0.0f, 1.0f, 150)
+    //             .End()
+    //             .To(&m_offset, 48.0f, 250, MD3Easing::Standard);
+    //
+    // The root is a sequence. Only float properties are animated.
+    class MD3Timeline {
+    public:
+        MD3Timeline();
+
+        // Animate *target from startValue to endValue
+        MD3Timeline& Tween(float* target, float startValue, float endValue, long duration,
+                           MD3Easing easing = MD3Easing::EaseInOut);
+
+        // Animate *target to endValue from wherever the timeline left it (or from its value
+        // when playback starts, if no earlier item animates it)
+        MD3Timeline& To(float* target, float endValue, long duration, MD3Easing easing = MD3Easing::EaseInOut);
+
+        // Keyframed property; the first keyframe (normally at time 0) sets the start value
+        MD3Timeline& Keyframes(float* target, std::initializer_list<MD3Keyframe> keyframes);
+
+        // Empty item: a pause in a sequence, or a later end for a parallel group
+        MD3Timeline& Delay(long duration);
+
+        // Groups: items of a sequence run one after another, items of a parallel group start
+        // together, or stagger ms apart from each other. Every Begin needs a matching End().
+        MD3Timeline& BeginSequence();
+        MD3Timeline& BeginParallel(long stagger = 0);
+        MD3Timeline& End();
+
+        // Play the whole timeline count times (-1 = forever), reversing every other pass
+        // when alternate is set
+        MD3Timeline& SetRepeat(int count, bool alternate = false);
+
+        // Sort the segments into per-property arrays (done automatically on first playback)
+        void Compile();
+        bool IsCompiled() const { return m_compiled; }
+
+        // Length of one pass (ms)
+        long GetDuration() const { return static_cast<long>(m_length); }
+        int GetRepeatCount() const { return m_repeatCount; }
+        bool IsAlternating() const { return m_alternate; }
+
+        // Capture the start values of To() properties; call before the first Evaluate()
+        void Begin();
+
+        // Write every property at time ms into one pass (0 <= time <= GetDuration())
+        void Evaluate(float time);
+
+        size_t GetSegmentCount() const { return m_segments.size(); }
+        size_t GetChannelCount() const { return m_channels.size(); }
+
+    private:
+        struct Segment {
+            float* target;
+            float start;       // Absolute times (ms)
+            float end;
+            float from;
+            float to;
+            MD3Easing easing;
+            bool fromPrevious; // To(): starts where the property's previous segment ended
+        };
+
+        // All segments of one property, sorted by start time
+        struct Channel {
+            float* target;
+            uint32_t first;
+            uint32_t count;
+            float base;        // Value captured by Begin(), used by a leading To()
+        };
+
+        struct Group {
+            bool parallel;
+            float start;
+            float cursor;      // Sequence: where the next item starts
+            float end;         // Parallel: latest end of an item so far
+            float stagger;
+            uint32_t items;
+        };
+
+        std::vector<Segment> m_segments;
+        std::vector<Channel> m_channels;
+        std::vector<Group> m_groups;
+        float m_length;
+        int m_repeatCount;
+        bool m_alternate;
+        bool m_compiled;
+
+        // Reserve [start, start + duration) in the current group and return start
+        float Place(float duration);
+        void AddSegment(float* target, float start, float end, float from, float to,
+                        MD3Easing easing, bool fromPrevious);
+    };
+
+    // Plays a timeline through the animator (as a custom animation; owner, priority and
+    // callbacks work as for any other animation). GetDuration() covers all repeats and is
+    // -1 for an endless timeline.
+    class MD3TimelineAnimation : public MD3Animation {
+    public:
+        explicit MD3TimelineAnimation(MD3Timeline timeline, MD3AnimationType type = MD3AnimationType::Custom);
+
+        void Start() override;
+        void Update(float deltaTime) override;
+        bool IsCompleted() const override { return m_state == MD3AnimationState::Completed; }
+
+        MD3Timeline& GetTimeline() { return m_timeline; }
+
+    private:
+        MD3Timeline m_timeline;
+    };
+
+} // namespace wx_md3
+
+#endif // MD3TIMELINE_H
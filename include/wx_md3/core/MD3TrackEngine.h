@@ -0,0 +1,302 @@
+#ifndef MD3TRACKENGINE_H
+#define MD3TRACKENGINE_H
+
+#include <wx/colour.h>
+#include <wx/gdicmn.h>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "wx_md3/core/MD3AnimationTypes.h"
+#include "wx_md3/core/MD3InplaceFunction.h"
+
+namespace wx_md3 {
+
+    // Value kinds stored by the track engine
+    enum class MD3TrackKind : uint8_t {
+        Float,
+        Int,
+        Colour,
+        Point
+    };
+
+    // Maps a property type to its track kind (only float, int, wxColour and wxRealPoint
+    // are batched). Colours interpolate in premultiplied linear light (MD3ColourSpace.h).
+    // Other types have no kind; MD3PropertyAnimation animates them unbatched.
+    template<typename T> struct MD3TrackTraits { static constexpr bool batched = false; };
+    template<> struct MD3TrackTraits<float> {
+        static constexpr bool batched = true;
+        static constexpr MD3TrackKind kind = MD3TrackKind::Float;
+    };
+    template<> struct MD3TrackTraits<int> {
+        static constexpr bool batched = true;
+        static constexpr MD3TrackKind kind = MD3TrackKind::Int;
+    };
+    template<> struct MD3TrackTraits<wxColour> {
+        static constexpr bool batched = true;
+        static constexpr MD3TrackKind kind = MD3TrackKind::Colour;
+    };
+    template<> struct MD3TrackTraits<wxRealPoint> {
+        static constexpr bool batched = true;
+        static constexpr MD3TrackKind kind = MD3TrackKind::Point;
+    };
+
+    // Generation-checked reference to a track; stale ids never alias a newer track
+    struct MD3TrackId {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool IsNull() const { return index == UINT32_MAX; }
+    };
+
+    // Identity of an animated property: at most one live track is keyed per (target, type).
+    // Keys outlive their tracks so replaying the same property reuses the map entry.
+    struct MD3TrackKey {
+        const void* target = nullptr;
+        MD3AnimationType type = MD3AnimationType::Custom;
+
+        bool operator==(const MD3TrackKey& other) const {
+            return target == other.target && type == other.type;
+        }
+    };
+
+    struct MD3TrackKeyHash {
+        size_t operator()(const MD3TrackKey& key) const {
+            return std::hash<const void*>()(key.target) ^ (static_cast<size_t>(key.type) * 0x9E3779B9u);
+        }
+    };
+
+    // Batched animation engine: property tracks live in contiguous per-kind arrays
+    // and are advanced in one pass per frame. Completed tracks are compacted with
+    // swap-remove, so removal is O(1) and the arrays stay dense. Slots, rows and
+    // callbacks are recycled, so once warmed up a frame performs no heap allocation.
+    class MD3TrackEngine {
+    public:
+        using Callback = MD3Callback;
+
+        MD3TrackEngine();
+
+        // Track creation (the new track is Stopped until Start() is called).
+        // A non-null target keys the track by (target, type), replacing any older key.
+        template<typename T>
+        MD3TrackId Add(MD3AnimationType type, T* target, const T& startValue, const T& endValue,
+                       long duration, MD3Easing easing);
+
+        // Live (not completed) track keyed by (target, type), or a null id
+        MD3TrackId Find(MD3AnimationType type, const void* target) const;
+
+        // Redirect the live track keyed by (target, type) towards endValue in place.
+        // A playing track restarts from its current value and keeps its current velocity,
+        // so rapid retargets stay smooth. Returns a null id when no such track exists.
+        template<typename T>
+        MD3TrackId Retarget(MD3AnimationType type, T* target, const T& endValue,
+                            long duration, MD3Easing easing);
+
+        // Play startValue -> endValue on the track keyed by (target, type), restarting the
+        // live track in place (keeping its callbacks) or adding a new one. Always Playing.
+        template<typename T>
+        MD3TrackId Play(MD3AnimationType type, T* target, const T& startValue, const T& endValue,
+                        long duration, MD3Easing easing);
+
+        // Per-track control
+        bool IsAlive(MD3TrackId id) const;
+        void Start(MD3TrackId id);
+        void Stop(MD3TrackId id);
+        void Pause(MD3TrackId id);
+        void Resume(MD3TrackId id);
+        void Remove(MD3TrackId id);
+
+        // Per-track queries (dead tracks report Completed)
+        MD3AnimationState GetState(MD3TrackId id) const;
+        float GetElapsedTime(MD3TrackId id) const;
+
+        // Per-track priority (defaults to MD3DefaultPriority of the track's type)
+        void SetPriority(MD3TrackId id, MD3AnimationPriority priority);
+        MD3AnimationPriority GetPriority(MD3TrackId id) const;
+
+        // Load shedding, set by the animator's frame budget. Tracks of a priority with
+        // interval 1 update every frame; with interval N their clocks still advance every
+        // frame (so they finish on time) but values are written and callbacks run only on
+        // every Nth frame (staggered across tracks); with interval 0 they finish at once.
+        void SetUpdateInterval(MD3AnimationPriority priority, uint32_t interval);
+        uint32_t GetUpdateInterval(MD3AnimationPriority priority) const;
+
+        // Per-track callbacks
+        void SetOnStartCallback(MD3TrackId id, Callback callback);
+        void SetOnUpdateCallback(MD3TrackId id, Callback callback);
+        void SetOnCompleteCallback(MD3TrackId id, Callback callback);
+
+        // Owner groups: tracks of one owner (normally a control) are culled and cancelled
+        // together. Group 0 means "no owner"; ids are recycled after ReleaseGroup().
+        uint32_t CreateGroup();
+        void ReleaseGroup(uint32_t group);      // Removes the group's remaining tracks
+        void SetGroup(MD3TrackId id, uint32_t group);
+
+        // O(1) bulk cancel: the group's tracks die immediately (their ids go stale, they are
+        // never advanced or written again, no callbacks run) and their rows are reclaimed by
+        // the next compaction. New tracks cannot join a cancelled group; release it once
+        // GetGroupTrackCount() drops to zero.
+        void CancelGroup(uint32_t group);
+        bool IsGroupCancelled(uint32_t group) const;
+        void SetGroupCulling(uint32_t group, MD3CullMode mode);
+        size_t GetGroupTrackCount(uint32_t group) const;
+
+        // Bulk control (used by MD3Animator::Start/Stop/ClearAnimations)
+        void StartAll();
+        void StopAll();
+        void Clear();
+
+        // Advance all playing tracks by deltaTime (ms), then compact completed tracks
+        void Advance(float deltaTime);
+
+        size_t GetTrackCount() const;
+        bool HasPlayingTracks() const { return m_playingCount > 0; }
+        size_t GetPlayingCount() const { return m_playingCount; }
+
+        // Playing tracks held back by MD3CullMode::Pause in the last Advance()
+        size_t GetCulledCount() const { return m_culledCount; }
+
+        // Updates skipped and tracks finished early by load shedding in the last Advance()
+        size_t GetShedSkippedCount() const { return m_shedSkipped; }
+        size_t GetShedFinishedCount() const { return m_shedFinished; }
+
+    private:
+        struct Callbacks {
+            Callback onStart;
+            Callback onUpdate;
+            Callback onComplete;
+        };
+
+        // One contiguous array per track attribute
+        template<typename T>
+        struct Column {
+            std::vector<T*> targets;
+            std::vector<T> startValues;
+            std::vector<T> endValues;
+            std::vector<float> elapsed;
+            std::vector<float> durations;
+            std::vector<float> velocities;    // Initial velocity (units/ms) carried over by Retarget
+            std::vector<MD3Easing> easings;
+            std::vector<MD3AnimationState> states;
+            std::vector<MD3AnimationType> types;
+            std::vector<uint32_t> slots;      // Back-reference into m_slots
+            std::vector<uint32_t> groups;     // Owner group (0 = none)
+            std::vector<MD3AnimationPriority> priorities;
+            std::vector<Callbacks> callbacks;
+
+            size_t Size() const { return targets.size(); }
+            void Push(uint32_t slot, MD3AnimationType type, T* target, const T& startValue,
+                      const T& endValue, float duration, MD3Easing easing);
+            void SwapRemove(size_t row);
+            void Clear();
+        };
+
+        // Per-frame scratch: playing rows grouped by easing for MD3Animation::EaseBatch
+        struct EaseBucket {
+            std::vector<uint32_t> rows;
+            std::vector<float> progress;
+            std::vector<float> eased;
+        };
+
+        // Stable id -> (kind, row) indirection; rows move on swap-remove, ids do not
+        struct Slot {
+            uint32_t row = 0;
+            uint32_t generation = 0;
+            MD3TrackKind kind = MD3TrackKind::Float;
+            bool used = false;
+        };
+
+        struct Group {
+            uint32_t tracks = 0;
+            MD3CullMode culling = MD3CullMode::None;
+            bool used = false;
+            bool cancelled = false;
+        };
+
+        Column<float> m_floats;
+        Column<int> m_ints;
+        Column<wxColour> m_colours;
+        Column<wxRealPoint> m_points;
+        std::vector<Slot> m_slots;
+        std::vector<uint32_t> m_freeSlots;
+        std::unordered_map<MD3TrackKey, MD3TrackId, MD3TrackKeyHash> m_keys;
+        std::vector<EaseBucket> m_easeBuckets;
+        std::vector<float> m_colourPlanes;   // Per-bucket scratch for MD3LerpColourPlanes
+        std::vector<Group> m_groups;
+        std::vector<uint32_t> m_freeGroups;
+        size_t m_playingCount;
+        size_t m_culledCount;
+        size_t m_cancelledGroups;    // Cancelled groups not yet released (Resolve() checks rows)
+        uint32_t m_updateIntervals[static_cast<size_t>(MD3AnimationPriority::Count)];
+        uint32_t m_frameIndex;
+        size_t m_shedSkipped;
+        size_t m_shedFinished;
+        bool m_advancing;
+        bool m_needsCompact;
+
+        template<typename T> Column<T>& GetColumn();
+
+        // Dispatch a generic lambda to the column holding tracks of the given kind
+        template<typename F> decltype(auto) Visit(MD3TrackKind kind, F&& f);
+        template<typename F> decltype(auto) Visit(MD3TrackKind kind, F&& f) const;
+
+        uint32_t AllocateSlot(MD3TrackKind kind, uint32_t row);
+        const Slot* Resolve(MD3TrackId id) const;
+        bool IsDead(MD3AnimationState state, uint32_t group) const;
+        void SetState(const Slot& slot, MD3AnimationState state, bool restart);
+
+        template<typename T> void AdvanceColumn(Column<T>& column, float deltaTime);
+        void LerpColourBucket(const Column<wxColour>& column, const EaseBucket& bucket);
+        template<typename T> void CompactColumn(Column<T>& column);
+        void Compact();
+        void PruneKeys();
+    };
+
+    template<> inline MD3TrackEngine::Column<float>& MD3TrackEngine::GetColumn<float>() { return m_floats; }
+    template<> inline MD3TrackEngine::Column<int>& MD3TrackEngine::GetColumn<int>() { return m_ints; }
+    template<> inline MD3TrackEngine::Column<wxColour>& MD3TrackEngine::GetColumn<wxColour>() { return m_colours; }
+    template<> inline MD3TrackEngine::Column<wxRealPoint>& MD3TrackEngine::GetColumn<wxRealPoint>() { return m_points; }
+
+    template<typename F>
+    decltype(auto) MD3TrackEngine::Visit(MD3TrackKind kind, F&& f) {
+        switch (kind) {
+            case MD3TrackKind::Int: return f(m_ints);
+            case MD3TrackKind::Colour: return f(m_colours);
+            case MD3TrackKind::Point: return f(m_points);
+            case MD3TrackKind::Float:
+            default: return f(m_floats);
+        }
+    }
+
+    template<typename F>
+    decltype(auto) MD3TrackEngine::Visit(MD3TrackKind kind, F&& f) const {
+        switch (kind) {
+            case MD3TrackKind::Int: return f(m_ints);
+            case MD3TrackKind::Colour: return f(m_colours);
+            case MD3TrackKind::Point: return f(m_points);
+            case MD3TrackKind::Float:
+            default: return f(m_floats);
+        }
+    }
+
+    template<typename T>
+    MD3TrackId MD3TrackEngine::Add(MD3AnimationType type, T* target, const T& startValue, const T& endValue,
+                                   long duration, MD3Easing easing) {
+        static_assert(MD3TrackTraits<T>::batched,
+                      "Tracks hold float, int, wxColour or wxRealPoint; use CreatePropertyAnimation for other types");
+        Column<T>& column = GetColumn<T>();
+        uint32_t row = static_cast<uint32_t>(column.Size());
+        uint32_t slot = AllocateSlot(MD3TrackTraits<T>::kind, row);
+        column.Push(slot, type, target, startValue, endValue, static_cast<float>(duration), easing);
+
+        MD3TrackId id;
+        id.index = slot;
+        id.generation = m_slots[slot].generation;
+        if (target) {
+            m_keys[MD3TrackKey{ target, type }] = id;
+        }
+        return id;
+    }
+
+} // namespace wx_md3
+
+#endif // MD3TRACKENGINE_H
@@ -1,16 +1,63 @@
 #include "wx_md3/core/MD3Animator.h"
+#include "wx_md3/core/MD3CubicBezier.h"
+#include "wx_md3/core/MD3ColourSpace.h"
+#include <wx/caret.h>
 #include <wx/log.h>
+#include <wx/toplevel.h>
+#include <wx/utils.h>
+#include <algorithm>
 #include <cmath>
+#ifdef __WXMSW__
+#include <wx/msw/wrapwin.h>
+#endif
 
 namespace wx_md3 {
 
     // Static member initialization
     std::unique_ptr<MD3Animator> MD3Animator::s_instance = nullptr;
 
+    // MD3FrameClock implementation
+    MD3FrameClock::MD3FrameClock()
+        : m_source(nullptr), m_frameTime(Now()), m_frameDelta(0.0f), m_maxFrameDelta(100.0f) {
+    }
+
+    void MD3FrameClock::SetSource(const MD3ClockSource* source) {
+        m_source = source;
+        Reset();
+    }
+
+    double MD3FrameClock::Read() const {
+        return m_source ? m_source->Now() : Now();
+    }
+
+    double MD3FrameClock::Now() {
+        using namespace std::chrono;
+        return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    float MD3FrameClock::BeginFrame() {
+        double now = Read();
+        float delta = static_cast<float>(now - m_frameTime);
+
+        // Clamp huge gaps (debugger, window drag, system stall) and clock jitter
+        if (delta > m_maxFrameDelta) delta = m_maxFrameDelta;
+        if (delta < 0.0f) delta = 0.0f;
+
+        m_frameTime = now;
+        m_frameDelta = delta;
+        return delta;
+    }
+
+    void MD3FrameClock::Reset() {
+        m_frameTime = Read();
+        m_frameDelta = 0.0f;
+    }
+
     // MD3Animation implementation
     MD3Animation::MD3Animation(MD3AnimationType type, long duration, MD3Easing easing)
         : m_type(type), m_state(MD3AnimationState::Stopped), m_duration(duration),
-          m_elapsedTime(0), m_easing(easing) {
+          m_elapsedTime(0.0f), m_easing(easing), m_owner(nullptr), m_priority(MD3DefaultPriority(type)),
+          m_deferredTime(0.0f), m_ownerGroup(0), m_animatorIndex(SIZE_MAX) {
     }
 
     MD3Animation::~MD3Animation() {
@@ -20,16 +67,18 @@ namespace wx_md3 {
     void MD3Animation::Start() {
         if (m_state == MD3AnimationState::Stopped || m_state == MD3AnimationState::Completed) {
             m_state = MD3AnimationState::Playing;
-            m_elapsedTime = 0;
+            m_elapsedTime = 0.0f;
             if (m_onStart) m_onStart();
+            MD3Animator::GetInstance().Wake();
         } else if (m_state == MD3AnimationState::Paused) {
             m_state = MD3AnimationState::Playing;
+            MD3Animator::GetInstance().Wake();
         }
     }
 
     void MD3Animation::Stop() {
         m_state = MD3AnimationState::Stopped;
-        m_elapsedTime = 0;
+        m_elapsedTime = 0.0f;
     }
 
     void MD3Animation::Pause() {
@@ -41,9 +90,14 @@ namespace wx_md3 {
     void MD3Animation::Resume() {
         if (m_state == MD3AnimationState::Paused) {
             m_state = MD3AnimationState::Playing;
+            MD3Animator::GetInstance().Wake();
         }
     }
 
+    void MD3Animation::Settle() {
+        Update(1.0e6f);
+    }
+
     // Easing function implementation
     float MD3Animation::Ease(float t, MD3Easing easing) {
         switch (easing) {
@@ -68,6 +122,10 @@ namespace wx_md3 {
             case MD3Easing::EaseInOutCubic:
                 return t < 0.5f ? 4.0f * t * t * t : 1.0f - pow(-2.0f * t + 2.0f, 3.0f) / 2.0f;
             default:
+                // MD3 spec and user-defined cubic-bezier curves
+                if (const MD3CubicBezier* curve = MD3CubicBezier::Find(easing)) {
+                    return curve->Evaluate(t);
+                }
                 return t;
         }
     }
@@ -76,16 +134,117 @@ namespace wx_md3 {
         return start + (end - start) * t;
     }
 
+    double MD3Animation::GetFrameTime() {
+        return MD3Animator::GetInstance().GetFrameClock().GetFrameTime();
+    }
+
+    // MD3AnimationHandle implementation
+    bool MD3AnimationHandle::IsValid() const {
+        return MD3Animator::GetInstance().GetTrackEngine().IsAlive(m_track);
+    }
+
+    MD3AnimationState MD3AnimationHandle::GetState() const {
+        return MD3Animator::GetInstance().GetTrackEngine().GetState(m_track);
+    }
+
+    long MD3AnimationHandle::GetElapsedTime() const {
+        return static_cast<long>(MD3Animator::GetInstance().GetTrackEngine().GetElapsedTime(m_track));
+    }
+
+    void MD3AnimationHandle::Start() {
+        MD3Animator::GetInstance().GetTrackEngine().Start(m_track);
+        MD3Animator::GetInstance().Wake();
+    }
+
+    void MD3AnimationHandle::Stop() {
+        MD3Animator::GetInstance().GetTrackEngine().Stop(m_track);
+    }
+
+    void MD3AnimationHandle::Pause() {
+        MD3Animator::GetInstance().GetTrackEngine().Pause(m_track);
+    }
+
+    void MD3AnimationHandle::Resume() {
+        MD3Animator::GetInstance().GetTrackEngine().Resume(m_track);
+        MD3Animator::GetInstance().Wake();
+    }
+
+    void MD3AnimationHandle::Remove() {
+        MD3Animator::GetInstance().GetTrackEngine().Remove(m_track);
+        m_track = MD3TrackId();
+    }
+
+    void MD3AnimationHandle::SetOnStartCallback(MD3Callback callback) {
+        MD3Animator::GetInstance().GetTrackEngine().SetOnStartCallback(m_track, std::move(callback));
+    }
+
+    void MD3AnimationHandle::SetOnUpdateCallback(MD3Callback callback) {
+        MD3Animator::GetInstance().GetTrackEngine().SetOnUpdateCallback(m_track, std::move(callback));
+    }
+
+    void MD3AnimationHandle::SetOnCompleteCallback(MD3Callback callback) {
+        MD3Animator::GetInstance().GetTrackEngine().SetOnCompleteCallback(m_track, std::move(callback));
+    }
+
+    void MD3AnimationHandle::SetOwner(wxWindow* owner) {
+        MD3Animator::GetInstance().SetTrackOwner(m_track, owner);
+    }
+
+    void MD3AnimationHandle::SetPriority(MD3AnimationPriority priority) {
+        MD3Animator::GetInstance().GetTrackEngine().SetPriority(m_track, priority);
+    }
+
+    // Whether any part of the window can currently be seen
+    static bool IsOnScreen(wxWindow* window) {
+        // Hidden itself or through a parent (this covers unselected notebook pages)
+        if (!window->IsShownOnScreen()) return false;
+
+        wxTopLevelWindow* frame = wxDynamicCast(wxGetTopLevelParent(window), wxTopLevelWindow);
+        if (frame && frame->IsIconized()) return false;
+
+        // Clipped: intersect the window with the client area of every parent up to the frame
+        wxRect rect = window->GetRect();
+        for (wxWindow* child = window; !child->IsTopLevel(); ) {
+            wxWindow* parent = child->GetParent();
+            if (!parent) break;
+
+            rect = rect.Intersect(wxRect(wxPoint(0, 0), parent->GetClientSize()));
+            if (rect.IsEmpty()) return false;
+            if (parent->IsTopLevel()) break;
+
+            // Into the grandparent's client coordinates
+            rect.Offset(parent->GetPosition());
+            rect.Offset(parent->GetClientAreaOrigin());
+            child = parent;
+        }
+        return true;
+    }
+
     // MD3Animator implementation
-    MD3Animator::MD3Animator() : m_isRunning(false) {
+    MD3Animator::MD3Animator()
+        : m_isRunning(false), m_timerActive(false), m_manualTicking(false), m_frameInterval(16),
+          m_timerInterval(16), m_inFrame(false), m_owners(1), m_cullMode(MD3CullMode::Finish), m_culledOwners(0),
+          m_cullPollInterval(100), m_slowPolling(false), m_phaseWait(false), m_frameBudget(8.0f), m_frameLoad(0.0f),
+          m_shedLevel(0), m_motionMode(MD3MotionMode::Full), m_lowPowerFrameInterval(100), m_budgetStreak(0),
+          m_frameIndex(0), m_updatingAnimations(false), m_animationHoles(false), m_posted(16384),
+          m_postWakePending(false), m_postsDropped(0) { // ~60 FPS
+        // The wxTimer is created on first Wake(), so a manually ticked animator never needs one
         Bind(wxEVT_TIMER, &MD3Animator::OnTimer, this);
-        // 🔧 设置定时器的所有者为 this (MD3Animator)
-        m_timer.SetOwner(this);
+        Bind(wxEVT_THREAD, &MD3Animator::OnPostWake, this);
+        SetMotionMode(DetectMotionMode());
+
+        // The caret blinks on/off at the system rate (GetBlinkTime is one half-period)
+        PhaseClock& blink = m_phaseClocks[static_cast<size_t>(MD3PhaseClock::Blink)];
+        int blinkTime = wxCaret::GetBlinkTime();
+        blink.period = blinkTime > 0 ? 2L * blinkTime : 1000;
+        blink.steps = 2;
+        m_phaseClocks[static_cast<size_t>(MD3PhaseClock::Progress)].period = 2000;
     }
 
     MD3Animator::~MD3Animator() {
         Stop();
         Unbind(wxEVT_TIMER, &MD3Animator::OnTimer, this);
+        Unbind(wxEVT_THREAD, &MD3Animator::OnPostWake, this);
     }
 
     MD3Animator& MD3Animator::GetInstance() {
@@ -97,79 +256,959 @@ namespace wx_md3 {
 
     void MD3Animator::AddAnimation(std::shared_ptr<MD3Animation> animation) {
         if (animation) {
-            m_animations.push_back(animation);
+            if (animation->IsBatched()) {
+                // Property animations live in the track engine, not in m_animations
+                animation->Attach();
+            } else if (animation->m_animatorIndex == SIZE_MAX) {
+                if (animation->m_owner) {
+                    animation->m_ownerGroup = AcquireOwner(animation->m_owner);
+                    m_owners[animation->m_ownerGroup].animations++;
+                }
+                animation->m_animatorIndex = m_animations.size();
+                m_animations.push_back(animation);
+            }
             if (m_isRunning && animation->GetState() == MD3AnimationState::Stopped) {
                 animation->Start();
             }
+            if (animation->GetState() == MD3AnimationState::Playing) {
+                Wake();
+            }
         }
     }
 
     void MD3Animator::RemoveAnimation(std::shared_ptr<MD3Animation> animation) {
-        m_animations.erase(
-            std::remove_if(m_animations.begin(), m_animations.end(),
-                          [&animation](const std::shared_ptr<MD3Animation>& anim) {
-                              return anim == animation;
-                          }),
-            m_animations.end());
+        if (animation && animation->IsBatched()) {
+            // Swap-remove the track from the engine
+            animation->Detach();
+            return;
+        }
+        if (!animation) return;
+
+        // O(1): the animation knows its slot
+        size_t index = animation->m_animatorIndex;
+        if (index >= m_animations.size() || m_animations[index] != animation) return;
+
+        DetachOwner(*animation);
+        animation->m_animatorIndex = SIZE_MAX;
+        if (m_updatingAnimations) {
+            // The frame loop is walking the list: leave a hole, compacted after the loop
+            m_animations[index].reset();
+            m_animationHoles = true;
+        } else {
+            m_animations[index] = std::move(m_animations.back());
+            m_animations.pop_back();
+            if (index < m_animations.size()) m_animations[index]->m_animatorIndex = index;
+        }
     }
 
     void MD3Animator::ClearAnimations() {
-        m_animations.clear();
+        for (auto& anim : m_animations) {
+            if (!anim) continue;
+            DetachOwner(*anim);
+            anim->m_animatorIndex = SIZE_MAX;
+        }
+        if (m_updatingAnimations) {
+            for (auto& anim : m_animations) anim.reset();
+            m_animationHoles = true;
+        } else {
+            m_animations.clear();
+        }
+        m_tracks.Clear();
+    }
+
+    void MD3Animator::CompactAnimations() {
+        size_t index = 0;
+        while (index < m_animations.size()) {
+            if (m_animations[index]) {
+                ++index;
+                continue;
+            }
+            m_animations[index] = std::move(m_animations.back());
+            m_animations.pop_back();
+            if (index < m_animations.size() && m_animations[index]) {
+                m_animations[index]->m_animatorIndex = index;
+            }
+        }
+        m_animationHoles = false;
     }
 
     void MD3Animator::Start() {
         if (!m_isRunning) {
             m_isRunning = true;
-            m_timer.Start(16); // ~60 FPS
 
-            // Start all stopped animations
+            // Start all stopped animations (each one wakes the timer)
             for (auto& anim : m_animations) {
+                if (!anim || (anim->m_ownerGroup != 0 && m_owners[anim->m_ownerGroup].cancelled)) continue;
                 if (anim->GetState() == MD3AnimationState::Stopped) {
                     anim->Start();
                 }
             }
+            m_tracks.StartAll();
+            if (HasPlayingAnimations() || m_postWakePending.load()) {
+                Wake();
+            }
         }
     }
 
     void MD3Animator::Stop() {
         if (m_isRunning) {
             m_isRunning = false;
-            m_timer.Stop();
+            if (m_timer) m_timer->Stop();
+            m_timerActive = false;
+            m_phaseWait = false;
 
             // Stop all animations
             for (auto& anim : m_animations) {
-                anim->Stop();
+                if (anim) anim->Stop();
             }
+            m_tracks.StopAll();
         }
     }
 
+    void MD3Animator::Wake() {
+        if (m_isRunning && m_phaseWait) {
+            // Waiting for a caret flip: keep the time waited so far, then run at the frame rate
+            double waited = m_frameClock.Read() - m_frameClock.GetFrameTime();
+            for (size_t index = 0; index < static_cast<size_t>(MD3PhaseClock::Count); ++index) {
+                PhaseClock& clock = m_phaseClocks[index];
+                if (IsPhaseClockLive(index) && waited > 0.0) {
+                    clock.elapsed = std::fmod(clock.elapsed + waited, static_cast<double>(clock.period));
+                }
+            }
+            m_phaseWait = false;
+            m_frameClock.Reset();
+            m_timerInterval = m_frameInterval;
+            if (m_timer) m_timer->Start(m_timerInterval);
+            return;
+        }
+        if (m_isRunning && m_slowPolling) {
+            // Only culled tracks were playing: back to full rate for the new animation
+            m_slowPolling = false;
+            m_frameClock.Reset();
+            m_timerInterval = m_frameInterval;
+            if (m_timer) m_timer->Start(m_timerInterval);
+            return;
+        }
+        if (m_isRunning && !m_timerActive) {
+            // Measure the first frame from now, not from when the timer went idle
+            m_frameClock.Reset();
+            if (!m_manualTicking) {
+                if (!m_timer) {
+                    // 🔧 定时器的所有者为 this (MD3Animator)
+                    m_timer = std::make_unique<wxTimer>(this);
+                }
+                // The first frame is prompt even in a low-power mode: it may be the only one
+                m_timerInterval = m_frameInterval;
+                m_timer->Start(m_timerInterval);
+            }
+            m_timerActive = true;
+        }
+    }
+
+    bool MD3Animator::HasPlayingAnimations() const {
+        if (m_tracks.HasPlayingTracks()) {
+            return true;
+        }
+        for (size_t index = 0; index < static_cast<size_t>(MD3PhaseClock::Count); ++index) {
+            if (IsPhaseClockLive(index)) return true;
+        }
+        for (const auto& anim : m_animations) {
+            if (anim && anim->GetState() == MD3AnimationState::Playing) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void MD3Animator::OnTimer(wxTimerEvent& event) {
         if (!m_isRunning) return;
+        m_stats.timerWakeups++;
+        RunFrame();
+    }
+
+    void MD3Animator::Tick() {
+        if (!m_isRunning) return;
+        RunFrame();
+    }
+
+    void MD3Animator::SetClockSource(const MD3ClockSource* source) {
+        m_frameClock.SetSource(source);
+        m_manualTicking = (source != nullptr);
+
+        // Hand pending frames over to the new driver (timer or Tick())
+        if (m_timerActive) {
+            m_timerActive = false;
+            m_phaseWait = false;
+            if (m_timer) m_timer->Stop();
+            Wake();
+        }
+    }
+
+    void MD3Animator::RunFrame() {
+        // Profiling is opt-in: with no profiler attached this is a single pointer test.
+        // Timestamps come from the frame clock, costs from the steady clock.
+        MD3FrameSample sample;
+        double costStart = 0.0;
+        if (m_profiler || m_frameBudget > 0.0f) {
+            costStart = MD3FrameClock::Now();
+        }
+        if (m_profiler) {
+            sample.shedLevel = static_cast<uint32_t>(m_shedLevel);
+            sample.frameStart = m_frameClock.Read();
+            sample.interval = static_cast<float>(sample.frameStart - m_frameClock.GetFrameTime());
+            sample.timerLateness = sample.interval - static_cast<float>(m_timerInterval);
+            sample.activeTracks = static_cast<uint32_t>(m_tracks.GetTrackCount() + m_animations.size());
+        }
+
+        // Measure the real time since the previous tick instead of assuming 16ms.
+        // After a slow culling poll only one regular frame's worth is applied, so tracks
+        // un-culled by this frame do not jump. A wait for the next phase step is longer than
+        // the clamp on purpose, so the phase clocks get the unclamped time.
+        double phaseDelta = m_frameClock.Read() - m_frameClock.GetFrameTime();
+        float deltaTime = m_frameClock.BeginFrame();
+        float lateness = 0.0f;
+        if (!m_phaseWait) {
+            phaseDelta = deltaTime;
+        }
+        if (m_slowPolling) {
+            deltaTime = std::min(deltaTime, static_cast<float>(GetActiveFrameInterval()));
+            m_stats.cullPolls++;
+        } else if (!m_phaseWait) {
+            lateness = std::max(0.0f, deltaTime - 2.0f * static_cast<float>(m_timerInterval));
+        }
+        m_inFrame = true;
+        m_frameIndex++;
+
+        // Retarget properties posted by worker threads since the previous frame
+        DrainPosted();
+
+        // Pause or finish tracks whose owner cannot be seen
+        UpdateCulling();
+
+        // Advance all property tracks in one batched pass
+        m_tracks.Advance(deltaTime);
+        m_stats.culledTracks += m_tracks.GetCulledCount();
+        m_stats.shedSkipped += m_tracks.GetShedSkippedCount();
+        m_stats.shedFinished += m_tracks.GetShedFinishedCount();
+
+        // Update the remaining (custom) animations
+        size_t customPlaying = 0;
+        size_t customCulled = 0;
+        // Indexed walk: callbacks may add animations (appended, updated this frame) or
+        // remove them (left as holes and compacted below)
+        m_updatingAnimations = true;
+        for (size_t index = 0; index < m_animations.size(); ++index) {
+            // Hold a reference: a callback may remove the animation that is running it
+            std::shared_ptr<MD3Animation> anim = m_animations[index];
+            if (!anim) continue;
+
+            bool cancelled = anim->m_ownerGroup != 0 && m_owners[anim->m_ownerGroup].cancelled;
+            if (!cancelled && anim->GetState() == MD3AnimationState::Playing) {
+                customPlaying++;
+                if (anim->m_ownerGroup != 0 && m_owners[anim->m_ownerGroup].culled) {
+                    customCulled++;
+                } else if (m_motionMode == MD3MotionMode::Reduced && anim->GetDuration() >= 0) {
+                    // Reduced motion: finite animations (springs, flings, timelines) settle now
+                    anim->m_deferredTime = 0.0f;
+                    anim->Settle();
+                } else if (ShouldUpdate(*anim, index, deltaTime)) {
+                    float step = deltaTime + anim->m_deferredTime;
+                    anim->m_deferredTime = 0.0f;
+                    anim->Update(step);
+                }
+            }
+
+            // Remove completed animations and those of cancelled owners
+            if ((cancelled || anim->IsCompleted()) && anim->m_animatorIndex == index) {
+                DetachOwner(*anim);
+                anim->m_animatorIndex = SIZE_MAX;
+                m_animations[index].reset();
+                m_animationHoles = true;
+            }
+        }
+        m_updatingAnimations = false;
+        if (m_animationHoles) {
+            CompactAnimations();
+        }
+
+        // Carets and spinners: one evaluation per clock, small invalidations per subscriber
+        size_t phaseVisible = AdvancePhaseClocks(static_cast<float>(std::max(0.0, phaseDelta)));
+
+        // Repaint every window touched this frame exactly once
+        m_inFrame = false;
+        double updateEnd = m_profiler ? MD3FrameClock::Now() : 0.0;
+        size_t repaints = FlushRepaints();
+
+        double frameEnd = costStart > 0.0 ? MD3FrameClock::Now() : 0.0;
+        if (m_frameBudget > 0.0f) {
+            UpdateShedding(static_cast<float>(frameEnd - costStart) + lateness);
+        }
+
+        if (m_profiler) {
+            sample.updateTime = static_cast<float>(updateEnd - costStart);
+            sample.paintTime = static_cast<float>(frameEnd - updateEnd);
+            sample.frameDuration = static_cast<float>(frameEnd - costStart);
+            sample.repaints = static_cast<uint32_t>(repaints);
+            m_profiler->Record(sample);
+        }
+
+        // Nothing left to animate: disarm the timer until AddAnimation/Resume wakes it
+        if (!HasPlayingAnimations()) {
+            if (m_timer) m_timer->Stop();
+            m_timerActive = false;
+            m_slowPolling = false;
+            m_phaseWait = false;
+            m_stats.idlePeriods++;
+
+            // The next burst of animations starts unshed
+            m_frameLoad = 0.0f;
+            SetShedLevel(0);
+            return;
+        }
+
+        // Only stepped phase clocks (carets) left: sleep until the next step flips
+        int stepWait = m_manualTicking || !m_timer ? -1 : GetPhaseStepWait();
+        if (stepWait >= 0) {
+            m_phaseWait = true;
+            m_slowPolling = false;
+            m_timerInterval = stepWait;
+            m_timer->StartOnce(stepWait);
+            return;
+        }
+
+        // Everything still playing is culled: only poll for the owners to reappear.
+        // Otherwise run at the frame rate of the motion mode.
+        bool onlyCulled = m_tracks.GetCulledCount() == m_tracks.GetPlayingCount() && customCulled == customPlaying &&
+                          phaseVisible == 0;
+        int interval = onlyCulled ? m_cullPollInterval : GetActiveFrameInterval();
+        if ((onlyCulled != m_slowPolling || interval != m_timerInterval || m_phaseWait) && !m_manualTicking && m_timer) {
+            m_phaseWait = false;
+            m_slowPolling = onlyCulled;
+            m_timerInterval = interval;
+            m_timer->Start(interval);
+        }
+    }
+
+    void MD3Animator::SetFrameBudget(float milliseconds) {
+        m_frameBudget = std::max(0.0f, milliseconds);
+        if (m_frameBudget == 0.0f) {
+            m_frameLoad = 0.0f;
+            SetShedLevel(0);
+        }
+    }
+
+    void MD3Animator::UpdateShedding(float load) {
+        if (load > m_frameBudget) m_stats.overBudgetFrames++;
+
+        // Exponential moving average, so a single slow frame does not trigger shedding
+        m_frameLoad += (load - m_frameLoad) * 0.25f;
+
+        if (m_frameLoad > m_frameBudget) {
+            // Degrade one step at a time and give each step a few frames to take effect
+            m_budgetStreak = std::max(m_budgetStreak, 0) + 1;
+            if (m_budgetStreak >= 3 && m_shedLevel < 2) {
+                SetShedLevel(m_shedLevel + 1);
+                m_budgetStreak = 0;
+            }
+        } else if (m_frameLoad < m_frameBudget * 0.5f) {
+            // Recover slowly so the level does not oscillate
+            m_budgetStreak = std::min(m_budgetStreak, 0) - 1;
+            if (m_budgetStreak <= -30 && m_shedLevel > 0) {
+                SetShedLevel(m_shedLevel - 1);
+                m_budgetStreak = 0;
+            }
+        } else {
+            m_budgetStreak = 0;
+        }
+    }
+
+    void MD3Animator::SetShedLevel(int level) {
+        if (level == m_shedLevel) return;
+        m_shedLevel = level;
+        m_stats.shedLevelChanges++;
+        ApplyUpdateIntervals();
+    }
+
+    void MD3Animator::ApplyUpdateIntervals() {
+        // Shed level and motion mode both map onto per-priority intervals (0 = finish at once)
+        uint32_t cosmetic = m_shedLevel >= 2 ? 0 : (m_shedLevel >= 1 ? 2 : 1);
+        uint32_t normal = m_shedLevel >= 2 ? 2 : 1;
+        uint32_t informative = 1;
+        if (m_motionMode != MD3MotionMode::Full) cosmetic = 0;
+        if (m_motionMode == MD3MotionMode::Reduced) normal = informative = 0;
+
+        m_tracks.SetUpdateInterval(MD3AnimationPriority::Cosmetic, cosmetic);
+        m_tracks.SetUpdateInterval(MD3AnimationPriority::Normal, normal);
+        m_tracks.SetUpdateInterval(MD3AnimationPriority::Informative, informative);
+    }
+
+    void MD3Animator::SetMotionMode(MD3MotionMode mode) {
+        m_motionMode = mode;
+        ApplyUpdateIntervals();
+
+        // Live transitions settle (or slow down) from the next frame; a caret frozen by
+        // Reduced motion starts blinking again
+        if (m_phaseWait) {
+            Wake();
+        } else if (m_timerActive && !m_manualTicking && m_timer && !m_slowPolling) {
+            m_timerInterval = m_frameInterval;
+            m_timer->Start(m_timerInterval);
+        } else if (!m_timerActive && HasPlayingAnimations()) {
+            Wake();
+        }
+        if (mode == MD3MotionMode::Reduced) {
+            RestartPhase(MD3PhaseClock::Blink);
+        }
+    }
+
+    bool MD3Animator::ShouldAnimate(MD3AnimationType type) const {
+        switch (m_motionMode) {
+            case MD3MotionMode::Reduced:
+                return false;
+            case MD3MotionMode::LowPower:
+                return MD3DefaultPriority(type) != MD3AnimationPriority::Cosmetic;
+            default:
+                return true;
+        }
+    }
+
+    void MD3Animator::SetLowPowerFrameInterval(int milliseconds) {
+        m_lowPowerFrameInterval = std::max(milliseconds, 1);
+    }
+
+    int MD3Animator::GetActiveFrameInterval() const {
+        if (m_motionMode == MD3MotionMode::Full) return m_frameInterval;
+        return std::max(m_frameInterval, m_lowPowerFrameInterval);
+    }
+
+    MD3MotionMode MD3Animator::DetectMotionMode() {
+        wxString value;
+        if (wxGetEnv("WX_MD3_MOTION", &value)) {
+            value.MakeLower();
+            if (value == "reduced" || value == "reduce") return MD3MotionMode::Reduced;
+            if (value == "low-power" || value == "lowpower") return MD3MotionMode::LowPower;
+            if (value == "full") return MD3MotionMode::Full;
+            wxLogWarning("MD3Animator: unknown WX_MD3_MOTION value '%s'", value);
+        }
+
+        // Every repaint of a remote session crosses the network
+#ifdef __WXMSW__
+        if (::GetSystemMetrics(SM_REMOTESESSION)) return MD3MotionMode::Reduced;
+#else
+        // A remote X display has a host name before the colon ("host:10.0", not ":0")
+        wxString display;
+        if (wxGetEnv("DISPLAY", &display) && !display.StartsWith(":") && !display.StartsWith("unix:")) {
+            return MD3MotionMode::Reduced;
+        }
+#endif
+        return MD3MotionMode::Full;
+    }
+
+    bool MD3Animator::ShouldUpdate(MD3Animation& animation, size_t index, float deltaTime) {
+        uint32_t interval = m_tracks.GetUpdateInterval(animation.m_priority);
+        if (interval == 1) return true;
+        if (interval == 0) interval = 4;
+
+        // Staggered like the tracks; the skipped time is applied on the next update
+        if ((m_frameIndex + index) % interval == 0) return true;
+        animation.m_deferredTime += deltaTime;
+        m_stats.shedSkipped++;
+        return false;
+    }
+
+    void MD3Animator::SetTrackOwner(MD3TrackId track, wxWindow* owner) {
+        if (!m_tracks.IsAlive(track)) return;
+        m_tracks.SetGroup(track, owner ? AcquireOwner(owner) : 0);
+    }
+
+    void MD3Animator::SetCullMode(wxWindow* owner, MD3CullMode mode) {
+        if (!owner) return;
+        uint32_t group = AcquireOwner(owner);
+        m_owners[group].mode = mode;
+        if (m_owners[group].culled) {
+            m_tracks.SetGroupCulling(group, mode);
+        }
+    }
+
+    bool MD3Animator::IsCulled(wxWindow* owner) const {
+        auto it = m_ownerGroups.find(owner);
+        return it != m_ownerGroups.end() && m_owners[it->second].culled;
+    }
+
+    uint32_t MD3Animator::AcquireOwner(wxWindow* window) {
+        auto it = m_ownerGroups.find(window);
+        if (it != m_ownerGroups.end()) {
+            if (m_owners[it->second].window.get() == window) return it->second;
+
+            // A new window at the address of a destroyed one whose destroy hook never ran
+            CancelGroup(it->second);
+            m_ownerGroups.erase(it);
+        }
 
-        // Update all animations
-        auto it = m_animations.begin();
-        while (it != m_animations.end()) {
-            auto& anim = *it;
-            if (anim->GetState() == MD3AnimationState::Playing) {
-                anim->Update(16.0f); // 16ms per frame
+        uint32_t group = m_tracks.CreateGroup();
+        if (group >= m_owners.size()) {
+            m_owners.resize(group + 1);
+        }
+        Owner& owner = m_owners[group];
+        owner = Owner();
+        owner.window = window;
+        owner.key = window;
+        owner.mode = m_cullMode;
+        m_ownerGroups[window] = group;
+
+        // MD3Control cancels from its destructor; this covers every other owner
+        window->Bind(wxEVT_DESTROY, &MD3Animator::OnOwnerDestroy, this);
+        return group;
+    }
+
+    void MD3Animator::CancelOwner(wxWindow* owner) {
+        auto it = m_ownerGroups.find(owner);
+        if (it == m_ownerGroups.end()) return;
+
+        uint32_t group = it->second;
+        m_ownerGroups.erase(it);
+        CancelGroup(group);
+    }
+
+    void MD3Animator::OnOwnerDestroy(wxWindowDestroyEvent& event) {
+        if (wxWindow* window = wxDynamicCast(event.GetEventObject(), wxWindow)) {
+            CancelOwner(window);
+        }
+        event.Skip();
+    }
+
+    void MD3Animator::CancelGroup(uint32_t group) {
+        Owner& owner = m_owners[group];
+        if (owner.cancelled) return;
+
+        owner.cancelled = true;
+        for (size_t clock = 0; clock < static_cast<size_t>(MD3PhaseClock::Count); ++clock) {
+            RemovePhaseSubscriber(static_cast<MD3PhaseClock>(clock), group);
+        }
+        if (owner.culled) {
+            owner.culled = false;
+            m_culledOwners--;
+        }
+        m_tracks.CancelGroup(group);
+
+        // Usually nothing is running: recycle the group right away, otherwise the frame
+        // loop drops the remaining tracks and animations and UpdateCulling() releases it
+        if (m_tracks.GetGroupTrackCount(group) == 0 && owner.animations == 0) {
+            m_tracks.ReleaseGroup(group);
+            owner = Owner();
+        }
+    }
+
+    void MD3Animator::DetachOwner(MD3Animation& animation) {
+        if (animation.m_ownerGroup != 0) {
+            m_owners[animation.m_ownerGroup].animations--;
+            animation.m_ownerGroup = 0;
+        }
+    }
+
+    void MD3Animator::UpdateCulling() {
+        for (uint32_t group = 1; group < m_owners.size(); ++group) {
+            Owner& owner = m_owners[group];
+            if (!owner.key) continue;
+
+            if (owner.cancelled) {
+                // Release once the engine and the custom list have let go of the group
+                if (m_tracks.GetGroupTrackCount(group) == 0 && owner.animations == 0) {
+                    m_tracks.ReleaseGroup(group);
+                    owner = Owner();
+                }
+                continue;
+            }
+
+            wxWindow* window = owner.window.get();
+            if (!window) {
+                // Destroyed without a destroy event reaching us
+                auto it = m_ownerGroups.find(owner.key);
+                if (it != m_ownerGroups.end() && it->second == group) m_ownerGroups.erase(it);
+                CancelGroup(group);
+                continue;
             }
 
-            // Remove completed animations
-            if (anim->IsCompleted()) {
-                it = m_animations.erase(it);
+            // Owners without animations or phase subscriptions are not checked (and cannot be culled)
+            bool idle = m_tracks.GetGroupTrackCount(group) == 0 && owner.animations == 0 &&
+                        !HasPhaseSubscriptions(owner);
+            bool culled = !idle && owner.mode != MD3CullMode::None && !IsOnScreen(window);
+            if (culled == owner.culled) continue;
+
+            owner.culled = culled;
+            m_tracks.SetGroupCulling(group, culled ? owner.mode : MD3CullMode::None);
+            if (culled) {
+                m_culledOwners++;
             } else {
-                ++it;
+                m_culledOwners--;
+                // Show whatever changed (or finished) while it was out of sight
+                if (!idle) QueueRepaint(window, nullptr);
             }
         }
     }
 
+    void MD3Animator::RequestRepaint(wxWindow* window) {
+        QueueRepaint(window, nullptr);
+    }
+
+    void MD3Animator::RequestRepaint(wxWindow* window, const wxRect& rect) {
+        QueueRepaint(window, &rect);
+    }
+
+    void MD3Animator::QueueRepaint(wxWindow* window, const wxRect* rect) {
+        if (!window) return;
+        if (!m_inFrame) {
+            window->Refresh(true, rect);
+            return;
+        }
+
+        m_stats.repaintRequests++;
+
+        if (m_culledOwners > 0) {
+            auto owner = m_ownerGroups.find(window);
+            if (owner != m_ownerGroups.end() && m_owners[owner->second].culled) {
+                m_stats.repaintsCulled++;
+                return;
+            }
+        }
+
+        // Keep the index table at most half full; it only grows, so steady frames do not allocate
+        if ((m_dirtyWindows.size() + 1) * 2 > m_dirtyTable.size()) {
+            m_dirtyTable.assign(std::max<size_t>(64, m_dirtyTable.size() * 2), 0);
+            for (size_t i = 0; i < m_dirtyWindows.size(); ++i) {
+                FindDirtySlot(m_dirtyWindows[i].window.get()) = static_cast<uint32_t>(i + 1);
+            }
+        }
+
+        uint32_t& slot = FindDirtySlot(window);
+        if (slot == 0) {
+            slot = static_cast<uint32_t>(m_dirtyWindows.size() + 1);
+            DirtyWindow dirty;
+            dirty.window = window;
+            dirty.rect = rect ? *rect : wxRect();
+            dirty.whole = (rect == nullptr);
+            m_dirtyWindows.push_back(dirty);
+            return;
+        }
+
+        // Already queued this frame: widen the pending area instead of repainting twice
+        m_stats.repaintsSaved++;
+        DirtyWindow& dirty = m_dirtyWindows[slot - 1];
+        if (!rect) {
+            dirty.whole = true;
+        } else if (!dirty.whole) {
+            dirty.rect.Union(*rect);
+        }
+    }
+
+    uint32_t& MD3Animator::FindDirtySlot(wxWindow* window) {
+        // Linear probing on the pointer value; the table size is a power of two
+        const size_t mask = m_dirtyTable.size() - 1;
+        size_t index = (reinterpret_cast<uintptr_t>(window) >> 4) * 0x9E3779B97F4A7C15ull & mask;
+        while (m_dirtyTable[index] != 0 && m_dirtyWindows[m_dirtyTable[index] - 1].window.get() != window) {
+            index = (index + 1) & mask;
+        }
+        return m_dirtyTable[index];
+    }
+
+    void MD3Animator::SubscribePhase(MD3PhaseClock clock, wxWindow* window, const wxRect& rect) {
+        if (!window || clock == MD3PhaseClock::Count) return;
+        uint32_t group = AcquireOwner(window);
+        PhaseClock& phaseClock = m_phaseClocks[static_cast<size_t>(clock)];
+        uint32_t& slot = m_owners[group].phaseSlots[static_cast<size_t>(clock)];
+        if (slot != 0) {
+            phaseClock.subscribers[slot - 1].rect = rect;
+            return;
+        }
+
+        PhaseSubscriber subscriber;
+        subscriber.window = window;
+        subscriber.group = group;
+        subscriber.rect = rect;
+        phaseClock.subscribers.push_back(subscriber);
+        slot = static_cast<uint32_t>(phaseClock.subscribers.size());
+        if (m_isRunning) Wake();
+    }
+
+    void MD3Animator::UnsubscribePhase(MD3PhaseClock clock, wxWindow* window) {
+        if (clock == MD3PhaseClock::Count) return;
+        auto it = m_ownerGroups.find(window);
+        if (it != m_ownerGroups.end()) {
+            RemovePhaseSubscriber(clock, it->second);
+        }
+    }
+
+    void MD3Animator::RemovePhaseSubscriber(MD3PhaseClock clock, uint32_t group) {
+        uint32_t& slot = m_owners[group].phaseSlots[static_cast<size_t>(clock)];
+        if (slot == 0) return;
+
+        // Swap-remove, then repoint the moved subscriber's owner at its new index
+        std::vector<PhaseSubscriber>& subscribers = m_phaseClocks[static_cast<size_t>(clock)].subscribers;
+        uint32_t index = slot - 1;
+        slot = 0;
+        if (index + 1 != subscribers.size()) {
+            subscribers[index] = subscribers.back();
+            m_owners[subscribers[index].group].phaseSlots[static_cast<size_t>(clock)] = index + 1;
+        }
+        subscribers.pop_back();
+    }
+
+    bool MD3Animator::HasPhaseSubscriptions(const Owner& owner) const {
+        for (uint32_t slot : owner.phaseSlots) {
+            if (slot != 0) return true;
+        }
+        return false;
+    }
+
+    float MD3Animator::GetPhase(MD3PhaseClock clock) const {
+        if (clock == MD3PhaseClock::Count) return 0.0f;
+        return m_phaseClocks[static_cast<size_t>(clock)].phase;
+    }
+
+    void MD3Animator::RestartPhase(MD3PhaseClock clock) {
+        if (clock == MD3PhaseClock::Count) return;
+        // The pending step wait was for the old phase: catch up, then wait afresh
+        if (m_phaseWait) Wake();
+        PhaseClock& phaseClock = m_phaseClocks[static_cast<size_t>(clock)];
+        bool changed = phaseClock.steps == 0 || phaseClock.step != 0;
+        phaseClock.elapsed = 0.0;
+        phaseClock.phase = 0.0f;
+        if (phaseClock.steps > 0) phaseClock.step = 0;
+        if (!changed) return;
+
+        // Show the restarted visual now rather than on the next flip
+        for (const PhaseSubscriber& subscriber : phaseClock.subscribers) {
+            QueueRepaint(subscriber.window, subscriber.rect.IsEmpty() ? nullptr : &subscriber.rect);
+        }
+    }
+
+    void MD3Animator::SetPhasePeriod(MD3PhaseClock clock, long milliseconds) {
+        if (clock == MD3PhaseClock::Count) return;
+        if (milliseconds <= 0) {
+            wxLogWarning("MD3Animator: phase period must be positive (got %ld)", milliseconds);
+            return;
+        }
+        if (m_phaseWait) Wake();
+        PhaseClock& phaseClock = m_phaseClocks[static_cast<size_t>(clock)];
+        phaseClock.elapsed = phaseClock.phase * static_cast<double>(milliseconds);
+        phaseClock.period = milliseconds;
+    }
+
+    bool MD3Animator::IsPhaseClockLive(size_t index) const {
+        // Reduced motion keeps the caret steady; progress still has to show activity
+        if (m_motionMode == MD3MotionMode::Reduced && index == static_cast<size_t>(MD3PhaseClock::Blink)) {
+            return false;
+        }
+        return !m_phaseClocks[index].subscribers.empty();
+    }
+
+    int MD3Animator::GetPhaseStepWait() const {
+        // Milliseconds to the earliest step flip, or -1 if anything needs every frame
+        if (m_tracks.HasPlayingTracks() || m_postWakePending.load()) return -1;
+        for (const auto& anim : m_animations) {
+            if (anim && anim->GetState() == MD3AnimationState::Playing) return -1;
+        }
+
+        bool stepped = false;
+        double wait = 0.0;
+        for (size_t index = 0; index < static_cast<size_t>(MD3PhaseClock::Count); ++index) {
+            const PhaseClock& clock = m_phaseClocks[index];
+            if (!IsPhaseClockLive(index)) continue;
+            if (clock.steps <= 0) return -1;
+            double stepLength = static_cast<double>(clock.period) / clock.steps;
+            double next = (clock.step + 1) * stepLength - clock.elapsed;
+            wait = stepped ? std::min(wait, next) : next;
+            stepped = true;
+        }
+        return stepped ? std::max(1, static_cast<int>(std::ceil(wait))) : -1;
+    }
+
+    size_t MD3Animator::AdvancePhaseClocks(float deltaTime) {
+        size_t visible = 0;
+        for (size_t index = 0; index < static_cast<size_t>(MD3PhaseClock::Count); ++index) {
+            PhaseClock& clock = m_phaseClocks[index];
+            if (!IsPhaseClockLive(index)) continue;
+            m_stats.phaseEvaluations++;
+
+            clock.elapsed = std::fmod(clock.elapsed + deltaTime, static_cast<double>(clock.period));
+            clock.phase = static_cast<float>(clock.elapsed / static_cast<double>(clock.period));
+
+            bool changed = true;
+            if (clock.steps > 0) {
+                int step = std::min(static_cast<int>(clock.phase * static_cast<float>(clock.steps)), clock.steps - 1);
+                changed = step != clock.step;
+                clock.step = step;
+            }
+
+            for (const PhaseSubscriber& subscriber : clock.subscribers) {
+                if (m_owners[subscriber.group].culled) continue;
+                visible++;
+                if (changed) {
+                    QueueRepaint(subscriber.window, subscriber.rect.IsEmpty() ? nullptr : &subscriber.rect);
+                    m_stats.phaseRepaints++;
+                }
+            }
+        }
+        return visible;
+    }
+
+    void MD3Animator::RegisterOwner(wxWindow* owner) {
+        if (owner) AcquireOwner(owner);
+    }
+
+    bool MD3Animator::Post(const PostedUpdate& update) {
+        if (!m_posted.TryPush(update)) {
+            m_postsDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // Only the first post since the last drain queues a wake event (QueueEvent is thread-safe)
+        if (!m_postWakePending.exchange(true)) {
+            QueueEvent(new wxThreadEvent(wxEVT_THREAD));
+        }
+        return true;
+    }
+
+    void MD3Animator::OnPostWake(wxThreadEvent& event) {
+        Wake();
+    }
+
+    void MD3Animator::DrainPosted() {
+        // Posts from here on need a new wake event
+        m_postWakePending.store(false);
+
+        // At most one queue's worth per frame, so fast producers cannot keep the frame draining
+        PostedUpdate update;
+        size_t budget = m_posted.GetCapacity();
+        for (; budget > 0 && m_posted.TryPop(update); --budget) {
+            if ((m_postBatch.size() + 1) * 2 > m_postTable.size()) {
+                m_postTable.assign(std::max<size_t>(64, m_postTable.size() * 2), 0);
+                for (size_t i = 0; i < m_postBatch.size(); ++i) {
+                    FindPostSlot(m_postBatch[i].target, m_postBatch[i].type) = static_cast<uint32_t>(i + 1);
+                }
+            }
+
+            // Last write wins per property
+            uint32_t& slot = FindPostSlot(update.target, update.type);
+            if (slot == 0) {
+                m_postBatch.push_back(update);
+                slot = static_cast<uint32_t>(m_postBatch.size());
+            } else {
+                m_postBatch[slot - 1] = update;
+                m_stats.postsCoalesced++;
+            }
+        }
+        m_stats.postsDropped += m_postsDropped.exchange(0);
+
+        // Budget used up: come back next frame even if nothing else is playing
+        if (budget == 0 && !m_postWakePending.exchange(true)) {
+            QueueEvent(new wxThreadEvent(wxEVT_THREAD));
+        }
+
+        if (m_postBatch.empty()) return;
+        std::fill(m_postTable.begin(), m_postTable.end(), 0u);
+        for (const PostedUpdate& posted : m_postBatch) {
+            ApplyPosted(posted);
+        }
+        m_postBatch.clear();
+    }
+
+    void MD3Animator::ApplyPosted(const PostedUpdate& update) {
+        // The owner must still be the registered, live window it was when the post was made
+        wxWindow* owner = update.owner;
+        if (owner) {
+            auto group = m_ownerGroups.find(owner);
+            if (group == m_ownerGroups.end() || m_owners[group->second].cancelled ||
+                m_owners[group->second].window.get() != owner) {
+                m_stats.postsDiscarded++;
+                return;
+            }
+        }
+
+        const MD3AnimationValue& value = update.value;
+        switch (value.type) {
+            case MD3AnimationValue::Type::Float:
+                AnimateProperty<float>(update.type, static_cast<float*>(update.target), value.floatValue,
+                                       update.duration, update.easing, owner);
+                break;
+            case MD3AnimationValue::Type::Int:
+                AnimateProperty<int>(update.type, static_cast<int*>(update.target), value.intValue,
+                                     update.duration, update.easing, owner);
+                break;
+            case MD3AnimationValue::Type::Color:
+                AnimateProperty<wxColour>(update.type, static_cast<wxColour*>(update.target),
+                                          wxColour(value.colorValue.r, value.colorValue.g,
+                                                   value.colorValue.b, value.colorValue.a),
+                                          update.duration, update.easing, owner);
+                break;
+            case MD3AnimationValue::Type::Point:
+                AnimateProperty<wxRealPoint>(update.type, static_cast<wxRealPoint*>(update.target),
+                                             wxRealPoint(value.pointValue.x, value.pointValue.y),
+                                             update.duration, update.easing, owner);
+                break;
+        }
+        m_stats.postsApplied++;
+    }
+
+    uint32_t& MD3Animator::FindPostSlot(const void* target, MD3AnimationType type) {
+        // Same probing scheme as FindDirtySlot, keyed on (target, type)
+        const size_t mask = m_postTable.size() - 1;
+        size_t index = ((reinterpret_cast<uintptr_t>(target) >> 2) ^ static_cast<size_t>(type)) * 0x9E3779B97F4A7C15ull & mask;
+        while (m_postTable[index] != 0) {
+            const PostedUpdate& entry = m_postBatch[m_postTable[index] - 1];
+            if (entry.target == target && entry.type == type) break;
+            index = (index + 1) & mask;
+        }
+        return m_postTable[index];
+    }
+
+    size_t MD3Animator::FlushRepaints() {
+        if (m_dirtyWindows.empty()) return 0;
+        size_t repaints = 0;
+
+        // Swap out first: paint handlers may request repaints of their own
+        std::vector<DirtyWindow> dirtyWindows;
+        dirtyWindows.swap(m_dirtyWindows);
+        std::fill(m_dirtyTable.begin(), m_dirtyTable.end(), 0u);
+
+        // Invalidate everything, then paint synchronously so each window paints once
+        for (DirtyWindow& dirty : dirtyWindows) {
+            if (wxWindow* window = dirty.window.get()) {
+                window->Refresh(true, dirty.whole ? nullptr : &dirty.rect);
+            }
+        }
+        for (DirtyWindow& dirty : dirtyWindows) {
+            if (wxWindow* window = dirty.window.get()) {
+                window->Update();
+                repaints++;
+            }
+        }
+
+        m_stats.repaintsFlushed += repaints;
+
+        // Reuse the allocation next frame
+        dirtyWindows.clear();
+        if (m_dirtyWindows.empty()) m_dirtyWindows.swap(dirtyWindows);
+        return repaints;
+    }
+
+    void MD3Animator::EnableProfiler(bool enable, size_t capacity) {
+        if (!enable) {
+            m_profiler.reset();
+        } else if (!m_profiler || m_profiler->GetCapacity() != capacity) {
+            m_profiler = std::make_unique<MD3AnimatorProfiler>(capacity);
+        }
+    }
+
     // Utility functions
     wxColour MD3Animator::LerpColour(const wxColour& start, const wxColour& end, float t) {
-        unsigned char r = static_cast<unsigned char>(start.Red() + (end.Red() - start.Red()) * t);
-        unsigned char g = static_cast<unsigned char>(start.Green() + (end.Green() - start.Green()) * t);
-        unsigned char b = static_cast<unsigned char>(start.Blue() + (end.Blue() - start.Blue()) * t);
-        unsigned char a = static_cast<unsigned char>(start.Alpha() + (end.Alpha() - start.Alpha()) * t);
-        return wxColour(r, g, b, a);
+        // Premultiplied linear light; scalar reference for MD3LerpColourPlanes
+        MD3LinearColour from = MD3ToLinearColour(start);
+        MD3LinearColour to = MD3ToLinearColour(end);
+        float alpha = from.a + (to.a - from.a) * t;
+        if (!(alpha > 0.0f)) return wxColour(0, 0, 0, 0);
+        return MD3FromStraightLinear((from.r + (to.r - from.r) * t) / alpha, (from.g + (to.g - from.g) * t) / alpha,
+                                     (from.b + (to.b - from.b) * t) / alpha, alpha);
     }
 
 } // namespace wx_md3
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "wx_md3/core/MD3AnimatorProfiler.h"
+#include <wx/ffile.h>
+#include <wx/log.h>
+#include <algorithm>
+
+namespace wx_md3 {
+
+    // Nearest-rank percentiles of one metric
+    template<typename F>
+    static MD3PercentileSummary SummarizeMetric(const MD3AnimatorProfiler& profiler, F&& metric) {
+        MD3PercentileSummary summary;
+        const size_t count = profiler.GetSampleCount();
+        if (count == 0) return summary;
+
+        std::vector<float> values(count);
+        double total = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = metric(profiler.GetSample(i));
+            total += values[i];
+        }
+        std::sort(values.begin(), values.end());
+
+        auto percentile = [&](float p) {
+            size_t rank = static_cast<size_t>(p * static_cast<float>(count - 1) + 0.5f);
+            return values[std::min(rank, count - 1)];
+        };
+        summary.p50 = percentile(0.50f);
+        summary.p95 = percentile(0.95f);
+        summary.p99 = percentile(0.99f);
+        summary.max = values.back();
+        summary.mean = static_cast<float>(total / static_cast<double>(count));
+        return summary;
+    }
+
+    MD3AnimatorProfiler::MD3AnimatorProfiler(size_t capacity)
+        : m_samples(std::max<size_t>(capacity, 1)), m_next(0), m_count(0) {
+    }
+
+    void MD3AnimatorProfiler::Record(const MD3FrameSample& sample) {
+        m_samples[m_next] = sample;
+        m_next = (m_next + 1) % m_samples.size();
+        if (m_count < m_samples.size()) m_count++;
+    }
+
+    void MD3AnimatorProfiler::Clear() {
+        m_next = 0;
+        m_count = 0;
+    }
+
+    const MD3FrameSample& MD3AnimatorProfiler::GetSample(size_t index) const {
+        size_t oldest = (m_next + m_samples.size() - m_count) % m_samples.size();
+        return m_samples[(oldest + index) % m_samples.size()];
+    }
+
+    MD3FrameTimeSummary MD3AnimatorProfiler::Summarize() const {
+        MD3FrameTimeSummary summary;
+        summary.frames = m_count;
+        summary.frameTime = SummarizeMetric(*this, [](const MD3FrameSample& s) { return s.frameDuration; });
+        summary.interval = SummarizeMetric(*this, [](const MD3FrameSample& s) { return s.interval; });
+        summary.lateness = SummarizeMetric(*this, [](const MD3FrameSample& s) { return s.timerLateness; });
+        return summary;
+    }
+
+    // JSON number with three decimals; Format("%.3f") would write a decimal comma in some locales
+    static wxString JsonNumber(double value) {
+        return wxString::FromCDouble(value, 3);
+    }
+
+    wxString MD3AnimatorProfiler::ExportChromeTrace() const {
+        // Complete ("X") events for the frame and its phases, counter ("C") events for load.
+        // Timestamps are microseconds relative to the oldest sample.
+        wxString json;
+        json.reserve(m_count * 400);
+        json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+        const double origin = m_count > 0 ? GetSample(0).frameStart : 0.0;
+        for (size_t i = 0; i < m_count; ++i) {
+            const MD3FrameSample& s = GetSample(i);
+            double ts = (s.frameStart - origin) * 1000.0;
+
+            json += wxString::Format(
+                "{\"name\":\"Frame\",\"cat\":\"animator\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%s,\"dur\":%s,"
+                "\"args\":{\"interval_ms\":%s,\"lateness_ms\":%s,\"tracks\":%u,\"repaints\":%u,\"shed_level\":%u}},\n",
+                JsonNumber(ts), JsonNumber(s.frameDuration * 1000.0), JsonNumber(s.interval),
+                JsonNumber(s.timerLateness), s.activeTracks, s.repaints, s.shedLevel);
+            json += wxString::Format(
+                "{\"name\":\"Update\",\"cat\":\"animator\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%s,\"dur\":%s},\n",
+                JsonNumber(ts), JsonNumber(s.updateTime * 1000.0));
+            json += wxString::Format(
+                "{\"name\":\"Repaint\",\"cat\":\"animator\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%s,\"dur\":%s,"
+                "\"args\":{\"windows\":%u}},\n",
+                JsonNumber(ts + s.updateTime * 1000.0), JsonNumber(s.paintTime * 1000.0), s.repaints);
+            json += wxString::Format(
+                "{\"name\":\"Active tracks\",\"ph\":\"C\",\"pid\":1,\"ts\":%s,\"args\":{\"tracks\":%u}},\n",
+                JsonNumber(ts), s.activeTracks);
+            json += wxString::Format(
+                "{\"name\":\"Timer lateness\",\"ph\":\"C\",\"pid\":1,\"ts\":%s,\"args\":{\"ms\":%s}}%s\n",
+                JsonNumber(ts), JsonNumber(s.timerLateness), i + 1 < m_count ? "," : "");
+        }
+
+        json += "]}\n";
+        return json;
+    }
+
+    bool MD3AnimatorProfiler::SaveChromeTrace(const wxString& path) const {
+        wxFFile file(path, "w");
+        if (!file.IsOpened()) {
+            wxLogWarning("MD3AnimatorProfiler: cannot write trace to %s", path);
+            return false;
+        }
+        return file.Write(ExportChromeTrace());
+    }
+
+} // namespace wx_md3
@@ -49,11 +49,8 @@ namespace wx_md3 {
         // Set window style
         SetBackgroundStyle(wxBG_STYLE_PAINT);
 
-        // 🔧 设置字体 - 确保文字能显示
-        wxFont font = GetFont();
-        font.SetPointSize(12);  // 增大字体从 14 改为 12（因为之前可能太大）
-        font.SetWeight(wxFONTWEIGHT_BOLD);
-        SetFont(font);
+        // Shared label font from the theme (12pt bold)
+        SetFont(MD3Theme::GetCurrent().GetFont(MD3TypographyRole::LabelLarge));
 
         // Initialize appearance
         UpdateAppearance();
@@ -85,11 +82,37 @@ namespace wx_md3 {
 
     // Override MD3Control methods
     void MD3Button::SetState(MD3State state) {
+        // Colour shown right now, the start of the state layer transition
+        wxColour fromBackground = m_backgroundAnimation.IsPlaying() ? m_currentBackground : GetBackgroundColor();
+
         MD3Control::SetState(state);
         UpdateAppearance();
 
         // ✨ 使用动画处理阴影变化
         auto animator = &MD3Animator::GetInstance();
+
+        wxColour toBackground = GetBackgroundColor();
+        if (!animator->ShouldAnimate(MD3AnimationType::Hover)) {
+            m_backgroundAnimation.Remove();
+        } else if (toBackground != fromBackground) {
+            m_currentBackground = fromBackground;
+            m_backgroundAnimation = animator->AnimateProperty<wxColour>(
+                MD3AnimationType::Hover,
+                &m_currentBackground,
+                toBackground,
+                150,  // MD3 state layer fade
+                MD3Easing::Standard,
+                this
+            );
+            m_backgroundAnimation.SetOnUpdateCallback([this]() {
+                MD3Animator::GetInstance().RequestRepaint(this);
+            });
+            m_backgroundAnimation.SetOnCompleteCallback([this]() {
+                MD3Animator::GetInstance().RequestRepaint(this);
+            });
+
+            animator->Start();
+        }
         int targetElevation = m_elevation;
         
         // Handle elevation changes based on state
@@ -108,19 +131,24 @@ namespace wx_md3 {
                 break;
         }
         
-        // 如果目标阴影值与当前不同，创建动画
-        if (targetElevation != m_currentElevation) {
-            m_elevationAnimation = animator->CreatePropertyAnimation<int>(
+        // Reduced motion: jump to the target; the Refresh() below is the only repaint
+        if (!animator->ShouldAnimate(MD3AnimationType::Elevation)) {
+            m_elevationAnimation.Remove();
+            m_currentElevation = targetElevation;
+        }
+        // 如果目标阴影值与当前不同（或过渡仍在进行），动画过渡到目标值
+        else if (targetElevation != m_currentElevation || m_elevationAnimation.IsPlaying()) {
+            m_elevationAnimation = animator->AnimateProperty<int>(
                 MD3AnimationType::Elevation,
                 &m_currentElevation,
-                m_currentElevation,
                 targetElevation,
                 200,  // 200ms 阴影过渡
-                MD3Easing::EaseInOut
+                MD3Easing::EaseInOut,
+                this  // 不可见时剔除（暂停或直接完成）
             );
             
-            m_elevationAnimation->SetOnUpdateCallback([this]() {
-                Refresh();
+            m_elevationAnimation.SetOnUpdateCallback([this]() {
+                MD3Animator::GetInstance().RequestRepaint(this);
             });
             
             animator->Start();
@@ -165,30 +193,37 @@ namespace wx_md3 {
 
     void MD3Button::OnMouseLeftDown(wxMouseEvent& event) {
         if (IsEnabled()) {
-            // ✨ 创建涟漪动画
-            m_rippleCenter = event.GetPosition();
-            m_rippleRadius = 0.0f;
-            
             auto animator = &MD3Animator::GetInstance();
-            m_rippleAnimation = animator->CreatePropertyAnimation<float>(
-                MD3AnimationType::Ripple,
-                &m_rippleRadius,
-                0.0f,
-                1.0f,
-                300,  // 300ms 涟漪扩散
-                MD3Easing::Linear
-            );
-            
-            m_rippleAnimation->SetOnUpdateCallback([this]() {
-                Refresh();
-            });
-            
-            m_rippleAnimation->SetOnCompleteCallback([this]() {
-                m_rippleRadius = 0.0f;  // 重置涟漪
-                Refresh();
-            });
-            
-            animator->Start();
+            if (!animator->ShouldAnimate(MD3AnimationType::Ripple)) {
+                // Reduced motion: no ripple, the pressed state repaint is enough
+                m_rippleAnimation.Remove();
+                m_rippleRadius = 0.0f;
+            } else {
+                // ✨ 创建涟漪动画
+                m_rippleCenter = event.GetPosition();
+                m_rippleRadius = 0.0f;
+
+                m_rippleAnimation = animator->PlayProperty<float>(
+                    MD3AnimationType::Ripple,
+                    &m_rippleRadius,
+                    0.0f,
+                    1.0f,
+                    300,  // 300ms 涟漪扩散
+                    MD3Easing::Linear,
+                    this  // 不可见时剔除（暂停或直接完成）
+                );
+
+                m_rippleAnimation.SetOnUpdateCallback([this]() {
+                    MD3Animator::GetInstance().RequestRepaint(this);
+                });
+
+                m_rippleAnimation.SetOnCompleteCallback([this]() {
+                    m_rippleRadius = 0.0f;  // 重置涟漪
+                    MD3Animator::GetInstance().RequestRepaint(this);
+                });
+
+                animator->Start();
+            }
             
             MD3Control::OnMouseLeftDown(event);
 
@@ -232,22 +267,22 @@ namespace wx_md3 {
             return;
         }
 
-        auto theme = MD3Theme::GetCurrentTheme();
-        
-        // Get the current button appearance properties
-        wxColour bgColor = GetBackgroundColor();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+
+        // Get the current button appearance properties (mid-fade between states, if any)
+        wxColour bgColor = m_backgroundAnimation.IsPlaying() ? m_currentBackground : GetBackgroundColor();
         wxColour fgColor = GetForegroundColor();
         wxColour borderColor = GetBorderColor();
 
         // 🔧 首先绘制背景（清除之前的内容）
         wxColour clearColor = GetParent() ? GetParent()->GetBackgroundColour() : *wxWHITE;
-        dc.SetBrush(wxBrush(clearColor));
+        dc.SetBrush(theme.GetBrush(clearColor));
         dc.SetPen(*wxTRANSPARENT_PEN);
         dc.DrawRectangle(0, 0, size.GetWidth(), size.GetHeight());
 
         // Draw button background with rounded corners using DC
         if (bgColor.IsOk() && bgColor.Alpha() > 0) {
-            dc.SetBrush(wxBrush(bgColor));
+            dc.SetBrush(theme.GetBrush(bgColor));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRoundedRectangle(0, 0, size.GetWidth(), size.GetHeight(), m_cornerRadius);
         }
@@ -287,7 +322,7 @@ namespace wx_md3 {
             // 绘制涟漪圆形
             int currentRadius = static_cast<int>(maxRadius * m_rippleRadius);
             if (currentRadius > 0) {
-                dc.SetBrush(wxBrush(finalRippleColor));
+                dc.SetBrush(theme.GetBrush(finalRippleColor));
                 dc.SetPen(*wxTRANSPARENT_PEN);
                 dc.DrawCircle(m_rippleCenter.x, m_rippleCenter.y, currentRadius);
             }
@@ -295,7 +330,7 @@ namespace wx_md3 {
 
         // Draw button border for outlined variant
         if (m_variant == MD3ButtonVariant::Outlined) {
-            dc.SetPen(wxPen(borderColor, 1));
+            dc.SetPen(theme.GetPen(borderColor, 1));
             dc.SetBrush(*wxTRANSPARENT_BRUSH);
             dc.DrawRoundedRectangle(0, 0, size.GetWidth(), size.GetHeight(), m_cornerRadius);
         }
@@ -339,55 +374,37 @@ namespace wx_md3 {
     }
 
     wxColour MD3Button::GetBackgroundColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
-        wxColour bgColor;
+        // State colours are precomputed by the theme (MD3 state layers)
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+        MD3ColorState state = MD3ToColorState(m_state);
 
         switch (m_variant) {
             case MD3ButtonVariant::Filled:
-                bgColor = theme->GetColor("primary");
-                break;
+                return theme.GetStateColor(MD3ColorRole::Primary, state);
             case MD3ButtonVariant::Elevated:
-                bgColor = theme->GetColor("surface");
-                break;
+                return theme.GetStateColor(MD3ColorRole::Surface, state);
             case MD3ButtonVariant::Outlined:
             case MD3ButtonVariant::Text:
             default:
-                // Outlined and Text buttons should have transparent background
-                // Use surface color with alpha for hover/pressed states
+                // Outlined and Text buttons have a transparent background and only show
+                // the state layer while hovered or pressed
                 if (m_state == MD3State::Hover || m_state == MD3State::Pressed) {
-                    bgColor = theme->GetColor("surface");
-                    // Make it slightly transparent for hover/pressed states
-                    bgColor = theme->AdjustAlpha(bgColor, 0.08);
-                } else {
-                    // Fully transparent for normal state
-                    bgColor = wxColour(0, 0, 0, 0);
+                    return theme.GetStateColor(MD3ColorRole::Surface, state);
                 }
-                return bgColor;
-        }
-
-        // Adjust color based on state for Filled and Elevated buttons
-        switch (m_state) {
-            case MD3State::Pressed:
-                return theme->Darken(bgColor, 0.2);
-            case MD3State::Hover:
-                return theme->Lighten(bgColor, 0.1);
-            case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
-            default:
-                return bgColor;
+                return wxColour(0, 0, 0, 0);
         }
     }
 
     wxColour MD3Button::GetForegroundColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         wxColour color;
 
         switch (m_variant) {
             case MD3ButtonVariant::Filled:
-                color = theme->GetColor("onPrimary");
+                color = theme.GetColor(MD3ColorRole::OnPrimary);
                 break;
             case MD3ButtonVariant::Elevated:
-                color = theme->GetColor("onSurface");
+                color = theme.GetColor(MD3ColorRole::OnSurface);
                 break;
             case MD3ButtonVariant::Outlined:
             case MD3ButtonVariant::Text:
@@ -395,9 +412,9 @@ namespace wx_md3 {
                 // For outlined and text buttons, use primary color for normal state
                 // and on-surface color for disabled state
                 if (m_state == MD3State::Disabled) {
-                    color = theme->GetColor("onSurfaceVariant");
+                    color = theme.GetColor(MD3ColorRole::OnSurfaceVariant);
                 } else {
-                    color = theme->GetColor("primary");
+                    color = theme.GetColor(MD3ColorRole::Primary);
                 }
                 break;
         }
@@ -419,8 +436,8 @@ namespace wx_md3 {
     }
 
     wxColour MD3Button::GetBorderColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
-        return theme->GetColor("outline");
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+        return theme.GetColor(MD3ColorRole::Outline);
     }
 
 } // namespace wx_md3
\ No newline at end of file
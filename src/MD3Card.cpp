@@ -82,19 +82,24 @@ namespace wx_md3 {
                 break;
         }
 
-        // If target elevation is different from current, create animation
-        if (targetElevation != m_currentElevation) {
-            m_elevationAnimation = animator->CreatePropertyAnimation<int>(
+        // Reduced motion: jump to the target; the Refresh() below is the only repaint
+        if (!animator->ShouldAnimate(MD3AnimationType::Elevation)) {
+            m_elevationAnimation.Remove();
+            m_currentElevation = targetElevation;
+        }
+        // If target elevation differs from current (or a transition is running), animate towards it
+        else if (targetElevation != m_currentElevation || m_elevationAnimation.IsPlaying()) {
+            m_elevationAnimation = animator->AnimateProperty<int>(
                 MD3AnimationType::Elevation,
                 &m_currentElevation,
-                m_currentElevation,
                 targetElevation,
                 200,  // 200ms elevation transition
-                MD3Easing::EaseInOut
+                MD3Easing::EaseInOut,
+                this  // culled while the card is not visible
             );
 
-            m_elevationAnimation->SetOnUpdateCallback([this]() {
-                Refresh();
+            m_elevationAnimation.SetOnUpdateCallback([this]() {
+                MD3Animator::GetInstance().RequestRepaint(this);
             });
 
             animator->Start();
@@ -118,10 +123,12 @@ namespace wx_md3 {
     static void DrawParentBackgroundFallback(wxWindow* win, wxDC& dc, const wxRect& rect) {
         if (!win) return;
 
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+
         wxWindow* parent = win->GetParent();
         if (!parent) {
             // No parent window: fill with default background color
-            dc.SetBrush(wxBrush(win->GetBackgroundColour()));
+            dc.SetBrush(theme.GetBrush(win->GetBackgroundColour()));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
             return;
@@ -132,12 +139,12 @@ namespace wx_md3 {
         
         // If parent has a valid background color, use it
         if (parentBgColor.IsOk()) {
-            dc.SetBrush(wxBrush(parentBgColor));
+            dc.SetBrush(theme.GetBrush(parentBgColor));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
         } else {
             // Fallback to system background color
-            dc.SetBrush(wxBrush(wxSystemSettings::GetColour(wxSYS_COLOUR_WINDOW)));
+            dc.SetBrush(theme.GetBrush(wxSystemSettings::GetColour(wxSYS_COLOUR_WINDOW)));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
         }
@@ -180,7 +187,7 @@ namespace wx_md3 {
             return;
         }
 
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
 
         // First draw parent background (clear previous content)
         wxRect rect(0, 0, size.GetWidth(), size.GetHeight());
@@ -192,68 +199,48 @@ namespace wx_md3 {
 
         // Draw card background with rounded corners
         if (bgColor.IsOk() && bgColor.Alpha() > 0) {
-            dc.SetBrush(wxBrush(bgColor));
+            dc.SetBrush(theme.GetBrush(bgColor));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRoundedRectangle(0, 0, size.GetWidth(), size.GetHeight(), m_cornerRadius);
         }
 
         // Draw card border for outlined variant
         if (m_variant == MD3CardVariant::Outlined) {
-            dc.SetPen(wxPen(borderColor, 1));
+            dc.SetPen(theme.GetPen(borderColor, 1));
             dc.SetBrush(*wxTRANSPARENT_BRUSH);
             dc.DrawRoundedRectangle(0, 0, size.GetWidth(), size.GetHeight(), m_cornerRadius);
         }
     }
 
     wxColour MD3Card::GetBackgroundColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
-        wxColour bgColor;
+        // State colours are precomputed by the theme (MD3 state layers)
+        const MD3Theme& theme = MD3Theme::GetCurrent();
 
         switch (m_variant) {
             case MD3CardVariant::Filled:
-                bgColor = theme->GetColor("surface");
-                break;
             case MD3CardVariant::Elevated:
-                bgColor = theme->GetColor("surface");
-                break;
+                return theme.GetStateColor(MD3ColorRole::Surface, MD3ToColorState(m_state));
             case MD3CardVariant::Outlined:
             default:
-                // Outlined cards should have transparent background
-                // Use surface color with alpha for hover/pressed states
+                // Outlined cards have a transparent background and only show the state
+                // layer while hovered or pressed
                 if (m_state == MD3State::Hover || m_state == MD3State::Pressed) {
-                    bgColor = theme->GetColor("surface");
-                    // Make it slightly transparent for hover/pressed states
-                    bgColor = theme->AdjustAlpha(bgColor, 0.08);
-                } else {
-                    // Fully transparent for normal state
-                    bgColor = wxColour(0, 0, 0, 0);
+                    return theme.GetStateColor(MD3ColorRole::Surface, MD3ToColorState(m_state));
                 }
-                return bgColor;
-        }
-
-        // Adjust color based on state
-        switch (m_state) {
-            case MD3State::Pressed:
-                return theme->Darken(bgColor, 0.1);
-            case MD3State::Hover:
-                return theme->Lighten(bgColor, 0.05);
-            case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
-            default:
-                return bgColor;
+                return wxColour(0, 0, 0, 0);
         }
     }
 
     wxColour MD3Card::GetBorderColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
 
         switch (m_state) {
             case MD3State::Hover:
-                return theme->GetColor("onSurfaceVariant");
+                return theme.GetColor(MD3ColorRole::OnSurfaceVariant);
             case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
+                return theme.GetColor(MD3ColorRole::SurfaceVariant);
             default:
-                return theme->GetColor("outline");
+                return theme.GetColor(MD3ColorRole::Outline);
         }
     }
 
@@ -40,10 +40,8 @@ namespace wx_md3 {
         m_strokeWidth = 2;
         m_checkProgress = 0.0f;
 
-        // 🔧 设置字体 - 确保文字能显示
-        wxFont font = GetFont();
-        font.SetPointSize(11);
-        SetFont(font);
+        // Shared body font from the theme (11pt)
+        SetFont(MD3Theme::GetCurrent().GetFont(MD3TypographyRole::BodyMedium));
 
         // 使用透明背景策略，让我们复制父窗口真实绘制内容
         if (!GetHandle()) {
@@ -73,29 +71,33 @@ namespace wx_md3 {
             
             // ✨ 使用 MD3Animator 创建流畅的勾线动画
             float targetProgress = value ? 1.0f : 0.0f;
-            float startProgress = m_checkProgress;
             
             // 创建动画对象
             auto animator = &MD3Animator::GetInstance();
-            m_checkAnimation = animator->CreatePropertyAnimation<float>(
+            if (!animator->ShouldAnimate(MD3AnimationType::ScaleFade)) {
+                // Reduced motion: draw the final check mark with a single repaint
+                m_checkAnimation.Remove();
+                m_checkProgress = targetProgress;
+                Refresh();
+                return;
+            }
+            m_checkAnimation = animator->AnimateProperty<float>(
                 MD3AnimationType::ScaleFade,
                 &m_checkProgress,
-                startProgress,
                 targetProgress,
                 400,  // 400ms 动画时长 - 比 switch 稍长一些
-                MD3Easing::EaseInOut
+                MD3Easing::EaseInOut,
+                this  // 不可见时剔除（暂停或直接完成）
             );
             
             // 设置动画更新回调 - 每帧刷新界面
-            m_checkAnimation->SetOnUpdateCallback([this]() {
-                Refresh();
-                Update();
+            m_checkAnimation.SetOnUpdateCallback([this]() {
+                MD3Animator::GetInstance().RequestRepaint(this);
             });
             
             // 动画完成回调
-            m_checkAnimation->SetOnCompleteCallback([this]() {
-                Refresh();
-                Update();
+            m_checkAnimation.SetOnCompleteCallback([this]() {
+                MD3Animator::GetInstance().RequestRepaint(this);
             });
             
             // 启动动画
@@ -198,10 +200,12 @@ namespace wx_md3 {
     static void DrawParentBackgroundFallback(wxWindow* win, wxDC& dc, const wxRect& rect) {
         if (!win) return;
 
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+
         wxWindow* parent = win->GetParent();
         if (!parent) {
             // 没有父窗口：用窗口默认背景色填充
-            dc.SetBrush(wxBrush(win->GetBackgroundColour()));
+            dc.SetBrush(theme.GetBrush(win->GetBackgroundColour()));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
             return;
@@ -244,7 +248,7 @@ namespace wx_md3 {
             return;
         }
 
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
 
         // 关键：先把父窗口当前的可见内容绘制到我们的 dc（支持复杂父背景）
         wxRect rect(0, 0, size.GetWidth(), size.GetHeight());
@@ -265,21 +269,21 @@ namespace wx_md3 {
         } else {
             // ❌ 未勾选：浅色或透明
             if (m_state == MD3State::Hover) {
-                checkboxBg = theme->GetColor("surfaceVariant");
+                checkboxBg = theme.GetColor(MD3ColorRole::SurfaceVariant);
             } else {
                 // 不再强制填成父背景色的单色（我们已经把父背景绘制到 DC），
                 // 若需要透明效果直接使用父背景色作为 fallback
                 if (GetParent()) {
                     checkboxBg = GetParent()->GetBackgroundColour();
                 } else {
-                    checkboxBg = theme->GetColor("surface"); // fallback
+                    checkboxBg = theme.GetColor(MD3ColorRole::Surface); // fallback
                 }
             }
         }
         
         // 绘制复选框背景（圆角矩形）
-        dc.SetBrush(wxBrush(checkboxBg));
-        dc.SetPen(wxPen(borderColor, 2));
+        dc.SetBrush(theme.GetBrush(checkboxBg));
+        dc.SetPen(theme.GetPen(borderColor, 2));
         dc.DrawRoundedRectangle(checkboxX, checkboxY, m_size, m_size, 2);
         
         // 绘制勾线（如果勾选或动画中）
@@ -294,7 +298,7 @@ namespace wx_md3 {
             int ch = dc.GetCharHeight();
             int labelY = (size.GetHeight() - ch) / 2;
             
-            dc.SetTextForeground(theme->GetColor("onSurface"));
+            dc.SetTextForeground(theme.GetColor(MD3ColorRole::OnSurface));
             dc.SetFont(GetFont());
             dc.SetBrush(*wxTRANSPARENT_BRUSH);
             dc.SetPen(*wxTRANSPARENT_PEN);
@@ -305,10 +309,10 @@ namespace wx_md3 {
 
     void MD3Checkbox::DrawCheckmark(wxDC& dc, int x, int y, float progress) {
         // 绘制动画勾线（保持主题色，但确保可见）
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         
         // 勾线用 onPrimary 色，如果看不清就用黑色
-        wxColour checkmarkColor = theme->GetColor("onPrimary");
+        wxColour checkmarkColor = theme.GetColor(MD3ColorRole::OnPrimary);
         
         // 安全检查：确保勾线可见
         int r = checkmarkColor.Red();
@@ -342,7 +346,7 @@ namespace wx_md3 {
         float y3 = cy - r_val * 0.35f;
         
         // 用粗线绘制（3px），更精致
-        dc.SetPen(wxPen(checkmarkColor, 3, wxPENSTYLE_SOLID));
+        dc.SetPen(theme.GetPen(checkmarkColor, 3, wxPENSTYLE_SOLID));
         dc.SetBrush(*wxTRANSPARENT_BRUSH);
         
         // 第一段：从起点到中点（进度 0-0.5）
@@ -365,37 +369,12 @@ namespace wx_md3 {
     }
 
     wxColour MD3Checkbox::GetCheckColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
-        
-        switch (m_state) {
-            case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
-            case MD3State::Pressed: {
-                wxColour primary = theme->GetColor("primary");
-                return wxColour(
-                    std::min(255, (int)primary.Red() + 30),
-                    std::min(255, (int)primary.Green() + 30),
-                    std::min(255, (int)primary.Blue() + 30)
-                );
-            }
-            default: {
-                // 返回亮蓝色而不是深蓝色
-                wxColour primary = theme->GetColor("primary");
-                int r = primary.Red();
-                int g = primary.Green();
-                int b = primary.Blue();
-                // 增加亮度 50%
-                return wxColour(
-                    std::min(255, r + (255 - r) / 2),
-                    std::min(255, g + (255 - g) / 2),
-                    std::min(255, b + (255 - b) / 2)
-                );
-            }
-        }
+        // Primary with the state layer of the current state, precomputed by the theme
+        return MD3Theme::GetCurrent().GetStateColor(MD3ColorRole::Primary, MD3ToColorState(m_state));
     }
 
     wxColour MD3Checkbox::GetBorderColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         
         if (m_checked) {
             return GetCheckColor();
@@ -403,11 +382,11 @@ namespace wx_md3 {
         
         switch (m_state) {
             case MD3State::Hover:
-                return theme->GetColor("onSurfaceVariant");
+                return theme.GetColor(MD3ColorRole::OnSurfaceVariant);
             case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
+                return theme.GetColor(MD3ColorRole::SurfaceVariant);
             default:
-                return theme->GetColor("outline");
+                return theme.GetColor(MD3ColorRole::Outline);
         }
     }
 
@@ -0,0 +1,66 @@
+#include "wx_md3/core/MD3ColourSpace.h"
+#include <algorithm>
+#include <cmath>
+
+namespace wx_md3 {
+
+    namespace {
+        // Decoding is exact per 8-bit value; encoding quantises linear light to 12 bits,
+        // which is finer than one 8-bit sRGB step everywhere on the curve
+        constexpr int kEncodeSteps = 4095;
+
+        struct SrgbTables {
+            float decode[256];
+            unsigned char encode[kEncodeSteps + 1];
+
+            SrgbTables() {
+                for (int i = 0; i < 256; ++i) {
+                    float c = static_cast<float>(i) / 255.0f;
+                    decode[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+                }
+                for (int i = 0; i <= kEncodeSteps; ++i) {
+                    float l = static_cast<float>(i) / static_cast<float>(kEncodeSteps);
+                    float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+                    encode[i] = static_cast<unsigned char>(std::lround(std::min(std::max(c, 0.0f), 1.0f) * 255.0f));
+                }
+            }
+        };
+
+        const SrgbTables& GetTables() {
+            static const SrgbTables tables;
+            return tables;
+        }
+    } // namespace
+
+    float MD3SrgbToLinear(unsigned char value) {
+        return GetTables().decode[value];
+    }
+
+    unsigned char MD3LinearToSrgb(float value) {
+        // Written so NaN clamps to 0
+        float clamped = value > 0.0f ? std::min(value, 1.0f) : 0.0f;
+        return GetTables().encode[static_cast<int>(clamped * static_cast<float>(kEncodeSteps) + 0.5f)];
+    }
+
+    MD3LinearColour MD3ToLinearColour(const wxColour& colour) {
+        const SrgbTables& tables = GetTables();
+        float a = static_cast<float>(colour.Alpha()) / 255.0f;
+        return MD3LinearColour{ tables.decode[colour.Red()] * a, tables.decode[colour.Green()] * a,
+                                tables.decode[colour.Blue()] * a, a };
+    }
+
+    wxColour MD3FromLinearColour(const MD3LinearColour& colour) {
+        if (!(colour.a > 0.0f)) return wxColour(0, 0, 0, 0);
+        return MD3FromStraightLinear(colour.r / colour.a, colour.g / colour.a, colour.b / colour.a, colour.a);
+    }
+
+    wxColour MD3FromStraightLinear(float r, float g, float b, float a) {
+        // Fully transparent: the colour channels carry no information
+        if (!(a > 0.0f)) return wxColour(0, 0, 0, 0);
+
+        float alpha = std::min(a, 1.0f);
+        return wxColour(MD3LinearToSrgb(r), MD3LinearToSrgb(g), MD3LinearToSrgb(b),
+                        static_cast<unsigned char>(alpha * 255.0f + 0.5f));
+    }
+
+} // namespace wx_md3
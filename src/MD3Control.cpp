@@ -1,6 +1,7 @@
 #include "wx_md3/core/MD3Control.h"
 #include <wx/dcbuffer.h>
 #include <wx/log.h>
+#include <algorithm>
 
 namespace wx_md3 {
 
@@ -20,6 +21,8 @@ namespace wx_md3 {
 
     IMPLEMENT_DYNAMIC_CLASS(MD3Control, wxWindow)
 
+    std::vector<MD3Control*> MD3Control::s_controls;
+
     // Constructor
     MD3Control::MD3Control() {
         Init();
@@ -44,11 +47,21 @@ namespace wx_md3 {
 
         // Set window style
         SetBackgroundStyle(wxBG_STYLE_PAINT);
+
+        m_registrySlot = s_controls.size();
+        s_controls.push_back(this);
     }
 
     // Destructor
     MD3Control::~MD3Control() {
-        // Cleanup resources
+        // Animations owned by this control target its members: cancel them all (O(1))
+        MD3Animator::GetInstance().CancelOwner(this);
+
+        // Leave the theme registry: the last control takes over our slot
+        MD3Control* last = s_controls.back();
+        s_controls[m_registrySlot] = last;
+        last->m_registrySlot = m_registrySlot;
+        s_controls.pop_back();
     }
 
     // State Management
@@ -83,6 +96,35 @@ namespace wx_md3 {
         }
     }
 
+    void MD3Control::UpdateAppearance() {
+        // Controls painting straight from the theme need nothing here
+    }
+
+    void MD3Control::NotifyThemeChanged() {
+        // Every control re-reads the theme; collect the top-level windows they live in (few,
+        // and consecutive controls nearly always share one)
+        std::vector<wxWindow*> topLevels;
+        for (size_t i = 0; i < s_controls.size(); ++i) {
+            MD3Control* control = s_controls[i];
+            control->UpdateAppearance();
+
+            wxWindow* top = wxGetTopLevelParent(control);
+            if (top && (topLevels.empty() || topLevels.back() != top) &&
+                std::find(topLevels.begin(), topLevels.end(), top) == topLevels.end()) {
+                topLevels.push_back(top);
+            }
+        }
+
+        // One event and one invalidation per window; the platform repaints its children together
+        for (wxWindow* top : topLevels) {
+            wxCommandEvent event(wxEVT_MD3_THEME_CHANGED, top->GetId());
+            event.SetInt(static_cast<int>(MD3Theme::GetCurrent().GetThemeType()));
+            event.SetEventObject(top);
+            top->ProcessWindowEvent(event);
+            top->Refresh();
+        }
+    }
+
     // Animation Support (enum-based - optimized)
     void MD3Control::StartAnimation(MD3AnimationType animationType) {
         if (static_cast<size_t>(animationType) < m_animations.size()) {
@@ -0,0 +1,128 @@
+#include "wx_md3/core/MD3CubicBezier.h"
+#include <wx/log.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace wx_md3 {
+
+    // MD3 motion spec curves, tabulated at compile time
+    static constexpr MD3CubicBezier s_standard(0.2f, 0.0f, 0.0f, 1.0f);
+    static constexpr MD3CubicBezier s_standardAccelerate(0.3f, 0.0f, 1.0f, 1.0f);
+    static constexpr MD3CubicBezier s_standardDecelerate(0.0f, 0.0f, 0.0f, 1.0f);
+    static constexpr MD3CubicBezier s_emphasizedAccelerate(0.3f, 0.0f, 0.8f, 0.15f);
+    static constexpr MD3CubicBezier s_emphasizedDecelerate(0.05f, 0.7f, 0.1f, 1.0f);
+    static constexpr MD3CubicBezier s_legacy(0.4f, 0.0f, 0.2f, 1.0f);
+
+    // User-defined curves, indexed by easing id - CubicBezierBase (UI thread only)
+    static std::vector<std::unique_ptr<MD3CubicBezier>>& RegisteredCurves() {
+        static std::vector<std::unique_ptr<MD3CubicBezier>> curves;
+        return curves;
+    }
+
+    float MD3CubicBezier::Evaluate(float x) const {
+        if (x <= 0.0f) return 0.0f;
+        if (x >= 1.0f) return 1.0f;
+
+        // Interpolate t from the table; x(t) is monotonic, so the exact t lies in [lo, hi]
+        float position = x * static_cast<float>(kTableSize - 1);
+        size_t index = static_cast<size_t>(position);
+        float fraction = position - static_cast<float>(index);
+        float lo = m_table[index];
+        float hi = m_table[index + 1];
+        float t = lo + (hi - lo) * fraction;
+
+        // Refine with Newton steps on x(t) = x; one is usually enough
+        for (int i = 0; i < 3; ++i) {
+            float error = SampleX(t) - x;
+            if (std::fabs(error) < 1e-6f) {
+                return SampleY(t);
+            }
+            float slope = SampleSlopeX(t);
+            if (std::fabs(slope) < 1e-6f) break;
+            t -= error / slope;
+            if (t < lo || t > hi) break;
+        }
+
+        // Newton left the bracket or stalled: x(t) is nearly flat here (an end with x1 or
+        // x2 at 0 or 1), so bisect within the table bracket instead
+        for (int i = 0; i < 24; ++i) {
+            t = (lo + hi) * 0.5f;
+            if (SampleX(t) < x) lo = t;
+            else hi = t;
+        }
+        return SampleY((lo + hi) * 0.5f);
+    }
+
+    void MD3CubicBezier::EvaluateBatch(const float* progress, float* out, size_t count) const {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = Evaluate(progress[i]);
+        }
+    }
+
+    float MD3CubicBezier::Solve(float x) const {
+        if (x <= 0.0f) return 0.0f;
+        if (x >= 1.0f) return 1.0f;
+
+        float t = x;
+        for (int i = 0; i < 8; ++i) {
+            float error = SampleX(t) - x;
+            if (std::fabs(error) < 1e-7f) return SampleY(t);
+            float slope = SampleSlopeX(t);
+            if (std::fabs(slope) < 1e-6f) break;
+            t -= error / slope;
+        }
+
+        float lo = 0.0f;
+        float hi = 1.0f;
+        t = x;
+        while (lo < hi) {
+            float value = SampleX(t);
+            if (std::fabs(value - x) < 1e-7f) break;
+            if (value < x) lo = t;
+            else hi = t;
+            float mid = (lo + hi) * 0.5f;
+            if (mid == t) break;
+            t = mid;
+        }
+        return SampleY(t);
+    }
+
+    MD3Easing MD3CubicBezier::Register(float x1, float y1, float x2, float y2) {
+        if (x1 < 0.0f || x1 > 1.0f || x2 < 0.0f || x2 > 1.0f) {
+            wxLogWarning("MD3CubicBezier: x control points must lie in [0, 1]; clamping");
+            x1 = std::min(1.0f, std::max(0.0f, x1));
+            x2 = std::min(1.0f, std::max(0.0f, x2));
+        }
+
+        auto& curves = RegisteredCurves();
+        for (size_t i = 0; i < curves.size(); ++i) {
+            const MD3CubicBezier& curve = *curves[i];
+            if (curve.m_x1 == x1 && curve.m_y1 == y1 && curve.m_x2 == x2 && curve.m_y2 == y2) {
+                return static_cast<MD3Easing>(static_cast<int>(MD3Easing::CubicBezierBase) + static_cast<int>(i));
+            }
+        }
+
+        curves.push_back(std::make_unique<MD3CubicBezier>(x1, y1, x2, y2));
+        return static_cast<MD3Easing>(static_cast<int>(MD3Easing::CubicBezierBase) + static_cast<int>(curves.size() - 1));
+    }
+
+    const MD3CubicBezier* MD3CubicBezier::Find(MD3Easing easing) {
+        switch (easing) {
+            case MD3Easing::Standard: return &s_standard;
+            case MD3Easing::StandardAccelerate: return &s_standardAccelerate;
+            case MD3Easing::StandardDecelerate: return &s_standardDecelerate;
+            case MD3Easing::EmphasizedAccelerate: return &s_emphasizedAccelerate;
+            case MD3Easing::EmphasizedDecelerate: return &s_emphasizedDecelerate;
+            case MD3Easing::Legacy: return &s_legacy;
+            default: break;
+        }
+
+        int index = static_cast<int>(easing) - static_cast<int>(MD3Easing::CubicBezierBase);
+        const auto& curves = RegisteredCurves();
+        if (index < 0 || static_cast<size_t>(index) >= curves.size()) return nullptr;
+        return curves[index].get();
+    }
+
+} // namespace wx_md3
@@ -0,0 +1,148 @@
+#include "MD3EasingKernels.h"
+#include "wx_md3/core/MD3Animator.h"
+#include "wx_md3/core/MD3ColourSpace.h"
+#include "wx_md3/core/MD3Simd.h"
+#include "wx_md3/core/MD3CubicBezier.h"
+#include "wx_md3/core/MD3Quantizer.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MD3_HAVE_SSE2_KERNELS
+#include <emmintrin.h>
+#endif
+
+namespace wx_md3 {
+
+#if defined(MD3_HAVE_SSE2_KERNELS)
+    namespace {
+        struct SSE2Ops {
+            using V = __m128;
+            static constexpr size_t kWidth = 4;
+            static V Load(const float* p) { return _mm_loadu_ps(p); }
+            static void Store(float* p, V v) { _mm_storeu_ps(p, v); }
+            static V Set1(float f) { return _mm_set1_ps(f); }
+            static V Add(V a, V b) { return _mm_add_ps(a, b); }
+            static V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+            static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+            static V Div(V a, V b) { return _mm_div_ps(a, b); }
+            static V Less(V a, V b) { return _mm_cmplt_ps(a, b); }
+            static V Select(V mask, V a, V b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+        };
+    } // namespace
+
+    size_t EaseBatchSSE2(const float* progress, float* out, size_t count, MD3Easing easing) {
+        return EaseKernel<SSE2Ops>(progress, out, count, easing);
+    }
+
+    size_t LerpColourPlanesSSE2(const float* const start[4], const float* const end[4], const float* t,
+                                float* const out[4], size_t count) {
+        return LerpColourKernel<SSE2Ops>(start, end, t, out, count);
+    }
+
+    size_t NearestCentresSSE2(const float* const points[3], size_t count, const float* const centres[3],
+                              size_t centreCount, uint32_t* nearest, float* distance) {
+        return NearestCentreKernel<SSE2Ops>(points, count, centres, centreCount, nearest, distance);
+    }
+#endif
+
+    // Batched easing: one easing applied to a whole array of progress values
+    void MD3Animation::EaseBatch(const float* progress, float* out, size_t count, MD3Easing easing) {
+        // Cubic-bezier curves go through their lookup table
+        if (const MD3CubicBezier* curve = MD3CubicBezier::Find(easing)) {
+            curve->EvaluateBatch(progress, out, count);
+            return;
+        }
+
+        size_t done = 0;
+
+        switch (MD3GetSimdLevel()) {
+#if defined(MD3_HAVE_AVX2_KERNELS)
+            case MD3SimdLevel::AVX2:
+                done = EaseBatchAVX2(progress, out, count, easing);
+                break;
+#endif
+#if defined(MD3_HAVE_SSE2_KERNELS)
+            case MD3SimdLevel::SSE2:
+                done = EaseBatchSSE2(progress, out, count, easing);
+                break;
+#endif
+            default:
+                break;
+        }
+
+        // Scalar reference for the tail (and for builds/CPUs without vector kernels)
+        for (size_t i = done; i < count; ++i) {
+            out[i] = Ease(progress[i], easing);
+        }
+    }
+
+    // Batched colour interpolation (planar, premultiplied linear)
+    void MD3LerpColourPlanes(const float* const start[4], const float* const end[4], const float* t,
+                             float* const out[4], size_t count) {
+        size_t done = 0;
+
+        switch (MD3GetSimdLevel()) {
+#if defined(MD3_HAVE_AVX2_KERNELS)
+            case MD3SimdLevel::AVX2:
+                done = LerpColourPlanesAVX2(start, end, t, out, count);
+                break;
+#endif
+#if defined(MD3_HAVE_SSE2_KERNELS)
+            case MD3SimdLevel::SSE2:
+                done = LerpColourPlanesSSE2(start, end, t, out, count);
+                break;
+#endif
+            default:
+                break;
+        }
+
+        // Scalar tail, the same steps as MD3Animator::LerpColour
+        for (size_t i = done; i < count; ++i) {
+            float alpha = start[3][i] + (end[3][i] - start[3][i]) * t[i];
+            for (int c = 0; c < 3; ++c) {
+                float value = start[c][i] + (end[c][i] - start[c][i]) * t[i];
+                out[c][i] = alpha > 0.0f ? value / alpha : 0.0f;
+            }
+            out[3][i] = alpha;
+        }
+    }
+
+    // Batched nearest-centre search (k-means assignment step of MD3QuantizeImage)
+    void MD3FindNearestCentres(const float* const points[3], size_t count, const float* const centres[3],
+                               size_t centreCount, uint32_t* nearest, float* distance) {
+        size_t done = 0;
+
+        switch (MD3GetSimdLevel()) {
+#if defined(MD3_HAVE_AVX2_KERNELS)
+            case MD3SimdLevel::AVX2:
+                done = NearestCentresAVX2(points, count, centres, centreCount, nearest, distance);
+                break;
+#endif
+#if defined(MD3_HAVE_SSE2_KERNELS)
+            case MD3SimdLevel::SSE2:
+                done = NearestCentresSSE2(points, count, centres, centreCount, nearest, distance);
+                break;
+#endif
+            default:
+                break;
+        }
+
+        // Scalar tail, the same operations in the same order as the kernel
+        for (size_t i = done; i < count; ++i) {
+            float best = 3.0e38f;
+            uint32_t bestIndex = 0;
+            for (size_t j = 0; j < centreCount; ++j) {
+                float d0 = points[0][i] - centres[0][j];
+                float d1 = points[1][i] - centres[1][j];
+                float d2 = points[2][i] - centres[2][j];
+                float d = (d0 * d0 + d1 * d1) + d2 * d2;
+                if (d < best) {
+                    best = d;
+                    bestIndex = static_cast<uint32_t>(j);
+                }
+            }
+            nearest[i] = bestIndex;
+            distance[i] = best;
+        }
+    }
+
+} // namespace wx_md3
@@ -0,0 +1,153 @@
+// Private header: batched easing kernels shared by the SSE2 and AVX2 translation units.
+// Each unit instantiates EaseKernel with its own vector ops type; everything here has
+// internal linkage so the differently-compiled copies never collide.
+#ifndef MD3EASINGKERNELS_H
+#define MD3EASINGKERNELS_H
+
+#include "wx_md3/core/MD3AnimationTypes.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace wx_md3 {
+
+    // Per-instruction-set entry points. They process whole vectors only and return the
+    // number of values written; the caller finishes the tail with the scalar reference.
+    // The AVX2 unit must not include anything with inline code shared with the rest of
+    // the library, or the linker could pick AVX2-compiled copies for non-AVX2 callers.
+    size_t EaseBatchSSE2(const float* progress, float* out, size_t count, MD3Easing easing);
+    size_t EaseBatchAVX2(const float* progress, float* out, size_t count, MD3Easing easing);
+    size_t LerpColourPlanesSSE2(const float* const start[4], const float* const end[4], const float* t,
+                                float* const out[4], size_t count);
+    size_t LerpColourPlanesAVX2(const float* const start[4], const float* const end[4], const float* t,
+                                float* const out[4], size_t count);
+    size_t NearestCentresSSE2(const float* const points[3], size_t count, const float* const centres[3],
+                              size_t centreCount, uint32_t* nearest, float* distance);
+    size_t NearestCentresAVX2(const float* const points[3], size_t count, const float* const centres[3],
+                              size_t centreCount, uint32_t* nearest, float* distance);
+
+    namespace {
+
+        template<typename Ops, typename F>
+        inline size_t EaseLoop(const float* progress, float* out, size_t count, F curve) {
+            size_t i = 0;
+            for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+                Ops::Store(out + i, curve(Ops::Load(progress + i)));
+            }
+            return i;
+        }
+
+        // Ops must provide: V, kWidth, Load, Store, Set1, Add, Sub, Mul, Div, Less, Select.
+        // The curves mirror MD3Animation::Ease operation for operation.
+        template<typename Ops>
+        inline size_t EaseKernel(const float* progress, float* out, size_t count, MD3Easing easing) {
+            using V = typename Ops::V;
+            const V one = Ops::Set1(1.0f);
+            const V two = Ops::Set1(2.0f);
+            const V four = Ops::Set1(4.0f);
+            const V half = Ops::Set1(0.5f);
+
+            switch (easing) {
+                case MD3Easing::Linear:
+                    return EaseLoop<Ops>(progress, out, count, [](V t) { return t; });
+                case MD3Easing::EaseIn:
+                case MD3Easing::EaseInQuad:
+                    return EaseLoop<Ops>(progress, out, count, [](V t) { return Ops::Mul(t, t); });
+                case MD3Easing::EaseOut:
+                    return EaseLoop<Ops>(progress, out, count, [=](V t) { return Ops::Mul(t, Ops::Sub(two, t)); });
+                case MD3Easing::EaseOutQuad:
+                    return EaseLoop<Ops>(progress, out, count, [=](V t) {
+                        V u = Ops::Sub(one, t);
+                        return Ops::Sub(one, Ops::Mul(u, u));
+                    });
+                case MD3Easing::EaseInOut:
+                case MD3Easing::EaseInOutQuad:
+                    return EaseLoop<Ops>(progress, out, count, [=](V t) {
+                        V in = Ops::Mul(Ops::Mul(two, t), t);
+                        V u = Ops::Add(Ops::Mul(Ops::Set1(-2.0f), t), two);
+                        V out = Ops::Sub(one, Ops::Mul(Ops::Mul(u, u), half));
+                        return Ops::Select(Ops::Less(t, half), in, out);
+                    });
+                case MD3Easing::EaseInCubic:
+                    return EaseLoop<Ops>(progress, out, count, [](V t) { return Ops::Mul(Ops::Mul(t, t), t); });
+                case MD3Easing::EaseOutCubic:
+                    return EaseLoop<Ops>(progress, out, count, [=](V t) {
+                        V u = Ops::Sub(one, t);
+                        return Ops::Sub(one, Ops::Mul(Ops::Mul(u, u), u));
+                    });
+                case MD3Easing::EaseInOutCubic:
+                    return EaseLoop<Ops>(progress, out, count, [=](V t) {
+                        V in = Ops::Mul(Ops::Mul(Ops::Mul(four, t), t), t);
+                        V u = Ops::Add(Ops::Mul(Ops::Set1(-2.0f), t), two);
+                        V out = Ops::Sub(one, Ops::Mul(Ops::Mul(Ops::Mul(u, u), u), half));
+                        return Ops::Select(Ops::Less(t, half), in, out);
+                    });
+                default:
+                    // No vector kernel for this curve; the caller uses the scalar path
+                    return 0;
+            }
+        }
+
+        // Premultiplied linear colour lerp, then un-premultiply (see MD3LerpColourPlanes).
+        // Mirrors MD3Animator::LerpColour operation for operation.
+        template<typename Ops>
+        inline size_t LerpColourKernel(const float* const start[4], const float* const end[4], const float* t,
+                                       float* const out[4], size_t count) {
+            using V = typename Ops::V;
+            const V zero = Ops::Set1(0.0f);
+
+            size_t i = 0;
+            for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+                V weight = Ops::Load(t + i);
+                V sa = Ops::Load(start[3] + i);
+                V alpha = Ops::Add(sa, Ops::Mul(Ops::Sub(Ops::Load(end[3] + i), sa), weight));
+                V visible = Ops::Less(zero, alpha);
+                for (int c = 0; c < 3; ++c) {
+                    V sc = Ops::Load(start[c] + i);
+                    V value = Ops::Add(sc, Ops::Mul(Ops::Sub(Ops::Load(end[c] + i), sc), weight));
+                    Ops::Store(out[c] + i, Ops::Select(visible, Ops::Div(value, alpha), zero));
+                }
+                Ops::Store(out[3] + i, alpha);
+            }
+            return i;
+        }
+
+        // Nearest centre per point by squared Euclidean distance over three planes (see
+        // MD3FindNearestCentres). Points run across the lanes, centres are broadcast one at
+        // a time; the strict compare keeps the lowest index on ties, like the scalar loop.
+        template<typename Ops>
+        inline size_t NearestCentreKernel(const float* const points[3], size_t count, const float* const centres[3],
+                                          size_t centreCount, uint32_t* nearest, float* distance) {
+            using V = typename Ops::V;
+            if (centreCount == 0) return 0;
+
+            size_t i = 0;
+            for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+                V p0 = Ops::Load(points[0] + i);
+                V p1 = Ops::Load(points[1] + i);
+                V p2 = Ops::Load(points[2] + i);
+                V best = Ops::Set1(3.0e38f);
+                V bestIndex = Ops::Set1(0.0f);
+                for (size_t j = 0; j < centreCount; ++j) {
+                    V d0 = Ops::Sub(p0, Ops::Set1(centres[0][j]));
+                    V d1 = Ops::Sub(p1, Ops::Set1(centres[1][j]));
+                    V d2 = Ops::Sub(p2, Ops::Set1(centres[2][j]));
+                    V d = Ops::Add(Ops::Add(Ops::Mul(d0, d0), Ops::Mul(d1, d1)), Ops::Mul(d2, d2));
+                    V closer = Ops::Less(d, best);
+                    best = Ops::Select(closer, d, best);
+                    bestIndex = Ops::Select(closer, Ops::Set1(static_cast<float>(j)), bestIndex);
+                }
+                float index[Ops::kWidth];
+                Ops::Store(index, bestIndex);
+                Ops::Store(distance + i, best);
+                for (size_t lane = 0; lane < Ops::kWidth; ++lane) {
+                    nearest[i + lane] = static_cast<uint32_t>(index[lane]);
+                }
+            }
+            return i;
+        }
+
+    } // namespace
+
+} // namespace wx_md3
+
+#endif // MD3EASINGKERNELS_H
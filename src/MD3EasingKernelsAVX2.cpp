@@ -0,0 +1,42 @@
+// AVX2 easing kernels. Built as a separate unit with AVX2 enabled (see meson.build)
+// and only called after runtime CPU detection reports AVX2 support.
+#include "MD3EasingKernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+namespace wx_md3 {
+
+    namespace {
+        struct AVX2Ops {
+            using V = __m256;
+            static constexpr size_t kWidth = 8;
+            static V Load(const float* p) { return _mm256_loadu_ps(p); }
+            static void Store(float* p, V v) { _mm256_storeu_ps(p, v); }
+            static V Set1(float f) { return _mm256_set1_ps(f); }
+            static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+            static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+            static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+            static V Div(V a, V b) { return _mm256_div_ps(a, b); }
+            static V Less(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static V Select(V mask, V a, V b) { return _mm256_blendv_ps(b, a, mask); }
+        };
+    } // namespace
+
+    size_t EaseBatchAVX2(const float* progress, float* out, size_t count, MD3Easing easing) {
+        return EaseKernel<AVX2Ops>(progress, out, count, easing);
+    }
+
+    size_t LerpColourPlanesAVX2(const float* const start[4], const float* const end[4], const float* t,
+                                float* const out[4], size_t count) {
+        return LerpColourKernel<AVX2Ops>(start, end, t, out, count);
+    }
+
+    size_t NearestCentresAVX2(const float* const points[3], size_t count, const float* const centres[3],
+                              size_t centreCount, uint32_t* nearest, float* distance) {
+        return NearestCentreKernel<AVX2Ops>(points, count, centres, centreCount, nearest, distance);
+    }
+
+} // namespace wx_md3
+
+#endif // __AVX2__
@@ -0,0 +1,381 @@
+#include "wx_md3/core/MD3Hct.h"
+#include "wx_md3/core/MD3ColourSpace.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace wx_md3 {
+
+    namespace {
+        constexpr double kPi = 3.14159265358979323846;
+
+        // Linear sRGB (0..100) <-> XYZ (D65, Y in 0..100)
+        constexpr double kXyzFromLinrgb[3][3] = {
+            { 0.41233895, 0.35762064, 0.18051042 },
+            { 0.2126, 0.7152, 0.0722 },
+            { 0.01932141, 0.11916382, 0.95034478 },
+        };
+
+        // XYZ -> CAM16 cone responses
+        constexpr double kConeFromXyz[3][3] = {
+            { 0.401288, 0.650173, -0.051461 },
+            { -0.250268, 1.204414, 0.045854 },
+            { -0.002079, 0.048952, 0.953127 },
+        };
+
+        constexpr double kWhitePoint[3] = { 95.047, 100.0, 108.883 };
+
+        void Multiply(const double m[3][3], const double v[3], double out[3]) {
+            for (int i = 0; i < 3; ++i) {
+                out[i] = m[i][0] * v[0] + m[i][1] * v[1] + m[i][2] * v[2];
+            }
+        }
+
+        void Invert(const double m[3][3], double out[3][3]) {
+            double det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+                         m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+                         m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    // Cofactor of m[j][i] (adjugate is the transposed cofactor matrix)
+                    int r0 = (j + 1) % 3, r1 = (j + 2) % 3, c0 = (i + 1) % 3, c1 = (i + 2) % 3;
+                    out[i][j] = (m[r0][c0] * m[r1][c1] - m[r0][c1] * m[r1][c0]) / det;
+                }
+            }
+        }
+
+        double LabF(double t) {
+            const double e = 216.0 / 24389.0, kappa = 24389.0 / 27.0;
+            return t > e ? std::cbrt(t) : (kappa * t + 16.0) / 116.0;
+        }
+
+        double LstarFromY(double y) {
+            return 116.0 * LabF(y / 100.0) - 16.0;
+        }
+
+        double YFromLstar(double lstar) {
+            const double e = 216.0 / 24389.0, kappa = 24389.0 / 27.0;
+            double ft = (lstar + 16.0) / 116.0;
+            double ft3 = ft * ft * ft;
+            return 100.0 * (ft3 > e ? ft3 : (116.0 * ft - 16.0) / kappa);
+        }
+
+        unsigned char SrgbFromLinear(double linear) {
+            double l = std::min(std::max(linear / 100.0, 0.0), 1.0);
+            double c = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+            return static_cast<unsigned char>(std::lround(std::min(std::max(c, 0.0), 1.0) * 255.0));
+        }
+
+        uint32_t Pack(const wxColour& colour) {
+            return (static_cast<uint32_t>(colour.Red()) << 16) | (static_cast<uint32_t>(colour.Green()) << 8) |
+                   colour.Blue();
+        }
+
+        wxColour Unpack(uint32_t rgb) {
+            return wxColour((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF);
+        }
+
+        wxColour GreyFromLstar(double lstar) {
+            unsigned char c = SrgbFromLinear(YFromLstar(lstar));
+            return wxColour(c, c, c);
+        }
+
+        // CAM16 viewing conditions and the matrices derived from them, computed once
+        struct Cam16 {
+            double n, aw, nbb, ncb, c, nc, fl, z;
+            double rgbD[3];
+            double linrgbFromXyz[3][3];
+            double xyzFromCone[3][3];
+            double tInnerCoeff;
+
+            Cam16() {
+                Invert(kXyzFromLinrgb, linrgbFromXyz);
+                Invert(kConeFromXyz, xyzFromCone);
+
+                const double adaptingLuminance = 200.0 / kPi * YFromLstar(50.0) / 100.0;
+                const double backgroundY = YFromLstar(50.0);
+                const double f = 0.8 + 2.0 / 10.0;   // Average surround
+                c = 0.69;
+                nc = f;
+                double d = f * (1.0 - (1.0 / 3.6) * std::exp((-adaptingLuminance - 42.0) / 92.0));
+                d = std::min(std::max(d, 0.0), 1.0);
+
+                double rgbW[3];
+                Multiply(kConeFromXyz, kWhitePoint, rgbW);
+                for (int i = 0; i < 3; ++i) {
+                    rgbD[i] = d * (100.0 / rgbW[i]) + 1.0 - d;
+                }
+
+                double k = 1.0 / (5.0 * adaptingLuminance + 1.0);
+                double k4 = k * k * k * k;
+                double k4F = 1.0 - k4;
+                fl = k4 * adaptingLuminance + 0.1 * k4F * k4F * std::cbrt(5.0 * adaptingLuminance);
+                n = backgroundY / kWhitePoint[1];
+                z = 1.48 + std::sqrt(n);
+                nbb = 0.725 / std::pow(n, 0.2);
+                ncb = nbb;
+
+                double rgbA[3];
+                for (int i = 0; i < 3; ++i) {
+                    double factor = std::pow(fl * rgbD[i] * rgbW[i] / 100.0, 0.42);
+                    rgbA[i] = 400.0 * factor / (factor + 27.13);
+                }
+                aw = (2.0 * rgbA[0] + rgbA[1] + 0.05 * rgbA[2]) * nbb;
+                tInnerCoeff = 1.0 / std::pow(1.64 - std::pow(0.29, n), 0.73);
+            }
+
+            // Linear sRGB (0..100) -> post-adaptation cone responses
+            void Adapt(const double linrgb[3], double adapted[3]) const {
+                double xyz[3], cone[3];
+                Multiply(kXyzFromLinrgb, linrgb, xyz);
+                Multiply(kConeFromXyz, xyz, cone);
+                for (int i = 0; i < 3; ++i) {
+                    double af = std::pow(fl * std::fabs(rgbD[i] * cone[i]) / 100.0, 0.42);
+                    adapted[i] = std::copysign(400.0 * af / (af + 27.13), cone[i]);
+                }
+            }
+
+            // Hue only, in radians [-pi, pi]
+            double HueRadians(const double linrgb[3]) const {
+                double adapted[3];
+                Adapt(linrgb, adapted);
+                double a = (11.0 * adapted[0] - 12.0 * adapted[1] + adapted[2]) / 11.0;
+                double b = (adapted[0] + adapted[1] - 2.0 * adapted[2]) / 9.0;
+                return std::atan2(b, a);
+            }
+
+            // Linear sRGB (0..100) -> hue (degrees) and chroma
+            void HueChroma(const double linrgb[3], double* hue, double* chroma) const {
+                double adapted[3];
+                Adapt(linrgb, adapted);
+
+                double a = (11.0 * adapted[0] - 12.0 * adapted[1] + adapted[2]) / 11.0;
+                double b = (adapted[0] + adapted[1] - 2.0 * adapted[2]) / 9.0;
+                double u = (20.0 * adapted[0] + 20.0 * adapted[1] + 21.0 * adapted[2]) / 20.0;
+                double p2 = (40.0 * adapted[0] + 20.0 * adapted[1] + adapted[2]) / 20.0;
+
+                double degrees = std::atan2(b, a) * 180.0 / kPi;
+                if (degrees < 0.0) degrees += 360.0;
+                if (degrees >= 360.0) degrees -= 360.0;
+
+                double ac = p2 * nbb;
+                double j = 100.0 * std::pow(ac / aw, c * z);
+                double huePrime = degrees < 20.14 ? degrees + 360.0 : degrees;
+                double eHue = 0.25 * (std::cos(huePrime * kPi / 180.0 + 2.0) + 3.8);
+                double p1 = 50000.0 / 13.0 * eHue * nc * ncb;
+                double t = p1 * std::hypot(a, b) / (u + 0.305);
+                double alpha = std::pow(t, 0.9) * std::pow(1.64 - std::pow(0.29, n), 0.73);
+
+                *hue = degrees;
+                *chroma = alpha * std::sqrt(j / 100.0);
+            }
+
+            // Inverse CAM16: J, chroma and hue (radians) -> linear sRGB (0..100, may be out of gamut)
+            void Linrgb(double j, double chroma, double hueRadians, double out[3]) const {
+                double jNormalized = j / 100.0;
+                double alpha = (chroma == 0.0 || j == 0.0) ? 0.0 : chroma / std::sqrt(jNormalized);
+                double t = std::pow(alpha * tInnerCoeff, 1.0 / 0.9);
+                double eHue = 0.25 * (std::cos(hueRadians + 2.0) + 3.8);
+                double ac = aw * std::pow(jNormalized, 1.0 / c / z);
+                double p1 = eHue * (50000.0 / 13.0) * nc * ncb;
+                double p2 = ac / nbb;
+                double hSin = std::sin(hueRadians);
+                double hCos = std::cos(hueRadians);
+                double gamma = 23.0 * (p2 + 0.305) * t / (23.0 * p1 + 11.0 * t * hCos + 108.0 * t * hSin);
+                double a = gamma * hCos;
+                double b = gamma * hSin;
+
+                double adapted[3] = {
+                    (460.0 * p2 + 451.0 * a + 288.0 * b) / 1403.0,
+                    (460.0 * p2 - 891.0 * a - 261.0 * b) / 1403.0,
+                    (460.0 * p2 - 220.0 * a - 6300.0 * b) / 1403.0,
+                };
+                double cone[3];
+                for (int i = 0; i < 3; ++i) {
+                    double base = std::max(0.0, 27.13 * std::fabs(adapted[i]) / (400.0 - std::fabs(adapted[i])));
+                    cone[i] = std::copysign(100.0 / fl * std::pow(base, 1.0 / 0.42), adapted[i]) / rgbD[i];
+                }
+                double xyz[3];
+                Multiply(xyzFromCone, cone, xyz);
+                Multiply(linrgbFromXyz, xyz, out);
+            }
+
+            // Newton's method on J for the requested Y (tone) at fixed hue and chroma, with
+            // 2 * Y(J) / J as the derivative estimate. False when the result is out of gamut.
+            bool SolveJ(double hueRadians, double chroma, double y, double linrgb[3]) const {
+                double j = std::sqrt(y) * 11.0;
+                for (int round = 0; round < 5; ++round) {
+                    Linrgb(j, chroma, hueRadians, linrgb);
+                    if (linrgb[0] < 0.0 || linrgb[1] < 0.0 || linrgb[2] < 0.0) return false;
+
+                    double fnj = kXyzFromLinrgb[1][0] * linrgb[0] + kXyzFromLinrgb[1][1] * linrgb[1] +
+                                 kXyzFromLinrgb[1][2] * linrgb[2];
+                    if (fnj <= 0.0) return false;
+                    if (round == 4 || std::fabs(fnj - y) < 0.002) {
+                        return linrgb[0] <= 100.01 && linrgb[1] <= 100.01 && linrgb[2] <= 100.01;
+                    }
+                    j -= (fnj - y) * j / (2.0 * fnj);
+                }
+                return false;
+            }
+        };
+
+        const Cam16& GetCam16() {
+            static const Cam16 cam16;
+            return cam16;
+        }
+
+        double WrapRadians(double angle) {
+            angle = std::fmod(angle, 2.0 * kPi);
+            return angle < 0.0 ? angle + 2.0 * kPi : angle;
+        }
+
+        // b lies on the arc going counter-clockwise from a to c
+        bool InCyclicOrder(double a, double b, double c) {
+            return WrapRadians(b - a) < WrapRadians(c - a);
+        }
+
+        // Vertex n (0..11) of the polygon where the plane of luminance y cuts the sRGB cube:
+        // two channels pinned to 0 or 100, the third solved for y. False when off the cube.
+        bool CubeVertex(double y, int n, double out[3]) {
+            const double* k = kXyzFromLinrgb[1];
+            double coordA = n % 4 <= 1 ? 0.0 : 100.0;
+            double coordB = n % 2 == 0 ? 0.0 : 100.0;
+            int free = n / 4;                       // Channel solved for y
+            int pinA = (free + 1) % 3, pinB = (free + 2) % 3;
+            out[pinA] = coordA;
+            out[pinB] = coordB;
+            out[free] = (y - coordA * k[pinA] - coordB * k[pinB]) / k[free];
+            return out[free] >= 0.0 && out[free] <= 100.0;
+        }
+
+        // The cube edge of constant y whose hue range brackets the target, then bisection along
+        // it by hue (hue is monotonic along a polygon edge)
+        bool BisectToGamutBoundary(const Cam16& cam16, double y, double targetHue, double out[3]) {
+            double left[3], right[3];
+            double leftHue = 0.0, rightHue = 0.0;
+            bool initialized = false, uncut = true;
+            for (int n = 0; n < 12; ++n) {
+                double mid[3];
+                if (!CubeVertex(y, n, mid)) continue;
+                double midHue = cam16.HueRadians(mid);
+                if (!initialized) {
+                    std::copy(mid, mid + 3, left);
+                    std::copy(mid, mid + 3, right);
+                    leftHue = rightHue = midHue;
+                    initialized = true;
+                    continue;
+                }
+                if (uncut || InCyclicOrder(leftHue, midHue, rightHue)) {
+                    uncut = false;
+                    if (InCyclicOrder(leftHue, targetHue, midHue)) {
+                        std::copy(mid, mid + 3, right);
+                        rightHue = midHue;
+                    } else {
+                        std::copy(mid, mid + 3, left);
+                        leftHue = midHue;
+                    }
+                }
+            }
+            if (!initialized) return false;
+
+            for (int step = 0; step < 24; ++step) {
+                double mid[3];
+                for (int i = 0; i < 3; ++i) mid[i] = 0.5 * (left[i] + right[i]);
+                double midHue = cam16.HueRadians(mid);
+                if (InCyclicOrder(leftHue, targetHue, midHue)) {
+                    std::copy(mid, mid + 3, right);
+                } else {
+                    std::copy(mid, mid + 3, left);
+                    leftHue = midHue;
+                }
+            }
+            for (int i = 0; i < 3; ++i) out[i] = 0.5 * (left[i] + right[i]);
+            return true;
+        }
+    } // namespace
+
+    MD3Hct MD3Hct::FromColour(const wxColour& colour) {
+        double linrgb[3] = { MD3SrgbToLinear(colour.Red()) * 100.0, MD3SrgbToLinear(colour.Green()) * 100.0,
+                             MD3SrgbToLinear(colour.Blue()) * 100.0 };
+        MD3Hct hct;
+        GetCam16().HueChroma(linrgb, &hct.hue, &hct.chroma);
+        double y = kXyzFromLinrgb[1][0] * linrgb[0] + kXyzFromLinrgb[1][1] * linrgb[1] + kXyzFromLinrgb[1][2] * linrgb[2];
+        hct.tone = LstarFromY(y);
+        return hct;
+    }
+
+    wxColour MD3Hct::ToColour() const {
+        return MD3HctToColour(hue, chroma, tone);
+    }
+
+    wxColour MD3HctToColour(double hue, double chroma, double tone) {
+        if (chroma < 0.0001 || tone < 0.0001 || tone > 99.9999) {
+            return GreyFromLstar(tone);
+        }
+
+        const Cam16& cam16 = GetCam16();
+        double degrees = std::fmod(hue, 360.0);
+        if (degrees < 0.0) degrees += 360.0;
+        double hueRadians = degrees * kPi / 180.0;
+        double y = YFromLstar(tone);
+
+        // Requested chroma out of reach: take the most chromatic colour of this hue and tone,
+        // which lies on the sRGB cube's surface
+        double linrgb[3];
+        if (!cam16.SolveJ(hueRadians, chroma, y, linrgb)) {
+            if (!BisectToGamutBoundary(cam16, y, hueRadians, linrgb)) {
+                return GreyFromLstar(tone);
+            }
+        }
+        return wxColour(SrgbFromLinear(linrgb[0]), SrgbFromLinear(linrgb[1]), SrgbFromLinear(linrgb[2]));
+    }
+
+    const int MD3TonalPalette::kTones[MD3TonalPalette::kToneCount] = { 0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 95, 99, 100 };
+
+    MD3TonalPalette::MD3TonalPalette(double hue, double chroma) : m_hue(hue), m_chroma(chroma) {
+        for (int i = 0; i < kToneCount; ++i) {
+            m_standard[i] = Pack(MD3HctToColour(hue, chroma, kTones[i]));
+        }
+    }
+
+    wxColour MD3TonalPalette::GetTone(int tone) const {
+        const int* it = std::find(kTones, kTones + kToneCount, tone);
+        if (it != kTones + kToneCount) {
+            return Unpack(m_standard[it - kTones]);
+        }
+        return MD3HctToColour(m_hue, m_chroma, tone);
+    }
+
+    MD3CorePalette::MD3CorePalette(const wxColour& seed) {
+        MD3Hct hct = MD3Hct::FromColour(seed);
+        primary = MD3TonalPalette(hct.hue, std::max(48.0, hct.chroma));
+        secondary = MD3TonalPalette(hct.hue, 16.0);
+        tertiary = MD3TonalPalette(hct.hue + 60.0, 24.0);
+        neutral = MD3TonalPalette(hct.hue, 4.0);
+        neutralVariant = MD3TonalPalette(hct.hue, 8.0);
+        error = MD3TonalPalette(25.0, 84.0);
+    }
+
+    std::shared_ptr<const MD3CorePalette> MD3CorePalette::Get(const wxColour& seed) {
+        // Small enough to keep every seed an app realistically cycles through
+        static const size_t kMaxSeeds = 64;
+        static std::mutex mutex;
+        static std::unordered_map<uint32_t, std::shared_ptr<const MD3CorePalette>> palettes;
+
+        uint32_t key = Pack(seed);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = palettes.find(key);
+            if (it != palettes.end()) return it->second;
+        }
+
+        // Solve outside the lock; a concurrent miss on the same seed just solves it twice
+        auto palette = std::make_shared<const MD3CorePalette>(seed);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (palettes.size() >= kMaxSeeds) palettes.clear();
+        return palettes.emplace(key, palette).first->second;
+    }
+
+} // namespace wx_md3
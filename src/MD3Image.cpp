@@ -1,4 +1,5 @@
 #include "wx_md3/components/MD3Image.h"
+#include "wx_md3/core/MD3Quantizer.h"
 #include <wx/dcbuffer.h>
 #include <wx/dcmemory.h>
 #include <wx/graphics.h>
@@ -59,6 +60,20 @@ namespace wx_md3 {
         }
     }
 
+    void MD3Image::ExtractSeedColorAsync(std::function<void(const wxColour&)> onSeed) {
+        if (!m_bitmap.IsOk()) {
+            wxLogWarning("MD3Image::ExtractSeedColorAsync: no bitmap set");
+            return;
+        }
+
+        if (!onSeed) {
+            // Theme propagation repaints every control (MD3Control::NotifyThemeChanged)
+            onSeed = [](const wxColour& seed) { MD3Theme::GetCurrentTheme()->SetSeedColor(seed); };
+        }
+        // The bitmap is a platform object, so the pixels are fetched here; the rest runs off-thread
+        MD3ExtractSeedColorAsync(m_bitmap.ConvertToImage(), this, std::move(onSeed));
+    }
+
     void MD3Image::SetImageShape(MD3ImageShape shape) {
         if (m_shape != shape) {
             m_shape = shape;
@@ -119,10 +134,12 @@ namespace wx_md3 {
 
     // Draw parent background - improved for Win32 compatibility
     void MD3Image::DrawParentBackground(wxDC& dc, const wxRect& rect) {
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+
         wxWindow* parent = GetParent();
         if (!parent) {
             // No parent window: fill with default background color
-            dc.SetBrush(wxBrush(GetBackgroundColour()));
+            dc.SetBrush(theme.GetBrush(GetBackgroundColour()));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
             return;
@@ -133,12 +150,12 @@ namespace wx_md3 {
         
         // If parent has a valid background color, use it
         if (parentBgColor.IsOk()) {
-            dc.SetBrush(wxBrush(parentBgColor));
+            dc.SetBrush(theme.GetBrush(parentBgColor));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
         } else {
             // Fallback to system background color
-            dc.SetBrush(wxBrush(wxSystemSettings::GetColour(wxSYS_COLOUR_WINDOW)));
+            dc.SetBrush(theme.GetBrush(wxSystemSettings::GetColour(wxSYS_COLOUR_WINDOW)));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
         }
@@ -179,7 +196,7 @@ namespace wx_md3 {
                 bgColor = *wxWHITE;
             }
             
-            memDC.SetBackground(wxBrush(bgColor));
+            memDC.SetBackground(MD3Theme::GetCurrent().GetBrush(bgColor));
             memDC.Clear();
             memDC.SelectObject(wxNullBitmap);
         }
@@ -0,0 +1,214 @@
+#include "wx_md3/core/MD3PhysicsAnimation.h"
+#include <wx/log.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace wx_md3 {
+
+    // Lowest damping ratio accepted: at 0 the spring oscillates forever and never settles
+    static const float kMinDampingRatio = 0.01f;
+
+    static float ClampDampingRatio(float dampingRatio) {
+        if (!(dampingRatio >= kMinDampingRatio)) {
+            wxLogWarning("MD3SpringAnimation: damping ratio %g would never settle, using %g",
+                         dampingRatio, kMinDampingRatio);
+            return kMinDampingRatio;
+        }
+        return dampingRatio;
+    }
+
+    // MD3SpringAnimation implementation
+    MD3SpringAnimation::MD3SpringAnimation(float* target, float finalValue, float stiffness, float dampingRatio,
+                                           MD3AnimationType type)
+        : MD3Animation(type, 0, MD3Easing::Linear), m_target(target), m_finalValue(finalValue),
+          m_stiffness(std::max(stiffness, 1e-3f)), m_dampingRatio(ClampDampingRatio(dampingRatio)),
+          m_startVelocity(0.0f), m_displacementThreshold(1e-3f), m_velocityThreshold(1e-2f),
+          m_anchorDisplacement(0.0f), m_anchorVelocity(0.0f), m_segmentTime(0.0f), m_velocity(0.0f) {
+    }
+
+    void MD3SpringAnimation::Start() {
+        if (m_state == MD3AnimationState::Stopped || m_state == MD3AnimationState::Completed) {
+            Anchor(m_target ? *m_target : m_finalValue, m_startVelocity);
+        }
+        MD3Animation::Start();
+    }
+
+    void MD3SpringAnimation::Anchor(float position, float velocity) {
+        m_anchorDisplacement = position - m_finalValue;
+        m_anchorVelocity = velocity;
+        m_segmentTime = 0.0f;
+        m_velocity = velocity;
+    }
+
+    void MD3SpringAnimation::Evaluate(float time, float& displacement, float& velocity) const {
+        const float x0 = m_anchorDisplacement;
+        const float v0 = m_anchorVelocity;
+        const float omega = std::sqrt(m_stiffness);
+        const float zeta = m_dampingRatio;
+
+        if (std::fabs(zeta - 1.0f) < 1e-4f) {
+            // Critically damped: x(t) = (x0 + (v0 + w x0) t) e^(-w t)
+            float b = v0 + omega * x0;
+            float decay = std::exp(-omega * time);
+            displacement = (x0 + b * time) * decay;
+            velocity = (v0 - omega * b * time) * decay;
+        } else if (zeta < 1.0f) {
+            // Under-damped: decaying oscillation at the damped frequency wd
+            float wd = omega * std::sqrt(1.0f - zeta * zeta);
+            float b = (v0 + zeta * omega * x0) / wd;
+            float decay = std::exp(-zeta * omega * time);
+            float c = std::cos(wd * time);
+            float s = std::sin(wd * time);
+            displacement = decay * (x0 * c + b * s);
+            velocity = decay * ((b * wd - zeta * omega * x0) * c - (x0 * wd + zeta * omega * b) * s);
+        } else {
+            // Over-damped: sum of two decaying exponentials
+            float root = omega * std::sqrt(zeta * zeta - 1.0f);
+            float r1 = -zeta * omega + root;
+            float r2 = -zeta * omega - root;
+            float c2 = (r1 * x0 - v0) / (r1 - r2);
+            float c1 = x0 - c2;
+            float e1 = std::exp(r1 * time);
+            float e2 = std::exp(r2 * time);
+            displacement = c1 * e1 + c2 * e2;
+            velocity = c1 * r1 * e1 + c2 * r2 * e2;
+        }
+    }
+
+    void MD3SpringAnimation::Update(float deltaTime) {
+        if (m_state != MD3AnimationState::Playing) return;
+
+        m_elapsedTime += deltaTime;
+        m_segmentTime += deltaTime / 1000.0f;
+
+        float displacement;
+        float velocity;
+        Evaluate(m_segmentTime, displacement, velocity);
+
+        // Settle early instead of chasing an invisible tail
+        if (std::fabs(displacement) < m_displacementThreshold && std::fabs(velocity) < m_velocityThreshold) {
+            Finish();
+            return;
+        }
+
+        m_velocity = velocity;
+        if (m_target) *m_target = m_finalValue + displacement;
+        if (m_onUpdate) m_onUpdate();
+    }
+
+    void MD3SpringAnimation::Settle() {
+        if (m_state == MD3AnimationState::Playing) Finish();
+    }
+
+    void MD3SpringAnimation::Finish() {
+        if (m_target) *m_target = m_finalValue;
+        m_velocity = 0.0f;
+        m_state = MD3AnimationState::Completed;
+        if (m_onUpdate) m_onUpdate();
+        if (m_onComplete) m_onComplete();
+    }
+
+    void MD3SpringAnimation::SetFinalValue(float finalValue) {
+        if (m_state == MD3AnimationState::Playing || m_state == MD3AnimationState::Paused) {
+            float displacement;
+            float velocity;
+            Evaluate(m_segmentTime, displacement, velocity);
+            float position = m_finalValue + displacement;
+            m_finalValue = finalValue;
+            Anchor(position, velocity);
+        } else {
+            m_finalValue = finalValue;
+        }
+    }
+
+    void MD3SpringAnimation::SetStiffness(float stiffness) {
+        // Re-anchor so the change applies from the current position and velocity
+        float position = m_target ? *m_target : m_finalValue;
+        m_stiffness = std::max(stiffness, 1e-3f);
+        if (m_state == MD3AnimationState::Playing || m_state == MD3AnimationState::Paused) {
+            Anchor(position, m_velocity);
+        }
+    }
+
+    void MD3SpringAnimation::SetDampingRatio(float dampingRatio) {
+        float position = m_target ? *m_target : m_finalValue;
+        m_dampingRatio = ClampDampingRatio(dampingRatio);
+        if (m_state == MD3AnimationState::Playing || m_state == MD3AnimationState::Paused) {
+            Anchor(position, m_velocity);
+        }
+    }
+
+    void MD3SpringAnimation::SetSettleThresholds(float displacement, float velocity) {
+        m_displacementThreshold = std::fabs(displacement);
+        m_velocityThreshold = std::fabs(velocity);
+    }
+
+    // MD3FlingAnimation implementation
+    MD3FlingAnimation::MD3FlingAnimation(float* target, float startVelocity, float friction, MD3AnimationType type)
+        : MD3Animation(type, 0, MD3Easing::Linear), m_target(target), m_startVelocity(startVelocity),
+          m_friction(std::max(friction, 1e-2f)), m_minValue(std::numeric_limits<float>::lowest()),
+          m_maxValue(std::numeric_limits<float>::max()), m_velocityThreshold(1.0f),
+          m_startValue(0.0f), m_time(0.0f), m_velocity(0.0f) {
+    }
+
+    void MD3FlingAnimation::Start() {
+        if (m_state == MD3AnimationState::Stopped || m_state == MD3AnimationState::Completed) {
+            m_startValue = m_target ? *m_target : 0.0f;
+            m_time = 0.0f;
+            m_velocity = m_startVelocity;
+        }
+        MD3Animation::Start();
+    }
+
+    void MD3FlingAnimation::SetFriction(float friction) {
+        m_friction = std::max(friction, 1e-2f);
+    }
+
+    void MD3FlingAnimation::SetBounds(float minValue, float maxValue) {
+        m_minValue = std::min(minValue, maxValue);
+        m_maxValue = std::max(minValue, maxValue);
+    }
+
+    float MD3FlingAnimation::GetRestingValue() const {
+        return m_startValue + m_startVelocity / m_friction;
+    }
+
+    void MD3FlingAnimation::Update(float deltaTime) {
+        if (m_state != MD3AnimationState::Playing) return;
+
+        m_elapsedTime += deltaTime;
+        m_time += deltaTime / 1000.0f;
+
+        // x(t) = x0 + v0 / f (1 - e^(-f t)),  v(t) = v0 e^(-f t)
+        float decay = std::exp(-m_friction * m_time);
+        float value = m_startValue + m_startVelocity / m_friction * (1.0f - decay);
+        m_velocity = m_startVelocity * decay;
+
+        if (value <= m_minValue) {
+            Finish(m_minValue);
+        } else if (value >= m_maxValue) {
+            Finish(m_maxValue);
+        } else if (std::fabs(m_velocity) < m_velocityThreshold) {
+            Finish(value);
+        } else {
+            if (m_target) *m_target = value;
+            if (m_onUpdate) m_onUpdate();
+        }
+    }
+
+    void MD3FlingAnimation::Settle() {
+        if (m_state == MD3AnimationState::Playing) {
+            Finish(std::min(std::max(GetRestingValue(), m_minValue), m_maxValue));
+        }
+    }
+
+    void MD3FlingAnimation::Finish(float value) {
+        if (m_target) *m_target = value;
+        m_velocity = 0.0f;
+        m_state = MD3AnimationState::Completed;
+        if (m_onUpdate) m_onUpdate();
+        if (m_onComplete) m_onComplete();
+    }
+
+} // namespace wx_md3
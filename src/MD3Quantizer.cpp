@@ -0,0 +1,594 @@
+#include "wx_md3/core/MD3Quantizer.h"
+#include "wx_md3/core/MD3ColourSpace.h"
+#include "wx_md3/core/MD3Hct.h"
+#include <wx/app.h>
+#include <wx/log.h>
+#include <wx/weakref.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+namespace wx_md3 {
+
+    namespace {
+        // Area-averages the opaque pixels onto a grid of at most maxSize cells per side and
+        // returns one 0xRRGGBB per non-empty cell
+        std::vector<uint32_t> SampleImage(const wxImage& image, int maxSize) {
+            std::vector<uint32_t> cells;
+            const int width = image.GetWidth();
+            const int height = image.GetHeight();
+            const unsigned char* rgb = image.GetData();
+            if (width <= 0 || height <= 0 || !rgb) return cells;
+            const unsigned char* alpha = image.HasAlpha() ? image.GetAlpha() : nullptr;
+
+            int longer = std::max(width, height);
+            double scale = longer > maxSize ? static_cast<double>(std::max(maxSize, 1)) / longer : 1.0;
+            const int gridWidth = std::max(1, static_cast<int>(std::lround(width * scale)));
+            const int gridHeight = std::max(1, static_cast<int>(std::lround(height * scale)));
+
+            // Cell cx covers columns [columnStart[cx], columnStart[cx + 1])
+            std::vector<int> columnStart(gridWidth + 1);
+            for (int cx = 0; cx <= gridWidth; ++cx) {
+                columnStart[cx] = static_cast<int>((static_cast<int64_t>(cx) * width + gridWidth - 1) / gridWidth);
+            }
+
+            // One row of cells is accumulated at a time
+            std::vector<uint64_t> sums(static_cast<size_t>(gridWidth) * 4);
+            auto flushRow = [&]() {
+                for (int cx = 0; cx < gridWidth; ++cx) {
+                    uint64_t* sum = &sums[static_cast<size_t>(cx) * 4];
+                    if (sum[3] == 0) continue;
+                    uint64_t half = sum[3] / 2;
+                    uint32_t r = static_cast<uint32_t>((sum[0] + half) / sum[3]);
+                    uint32_t g = static_cast<uint32_t>((sum[1] + half) / sum[3]);
+                    uint32_t b = static_cast<uint32_t>((sum[2] + half) / sum[3]);
+                    cells.push_back((r << 16) | (g << 8) | b);
+                }
+                std::fill(sums.begin(), sums.end(), 0);
+            };
+
+            cells.reserve(static_cast<size_t>(gridWidth) * gridHeight);
+            int currentRow = 0;
+            for (int y = 0; y < height; ++y) {
+                int cellRow = static_cast<int>(static_cast<int64_t>(y) * gridHeight / height);
+                if (cellRow != currentRow) {
+                    flushRow();
+                    currentRow = cellRow;
+                }
+                const unsigned char* row = rgb + static_cast<size_t>(y) * width * 3;
+                const unsigned char* rowAlpha = alpha ? alpha + static_cast<size_t>(y) * width : nullptr;
+                for (int cx = 0; cx < gridWidth; ++cx) {
+                    // Span sums stay in registers; a span is at most a few hundred pixels
+                    uint32_t r = 0, g = 0, b = 0, n = 0;
+                    const int x1 = columnStart[cx + 1];
+                    if (rowAlpha) {
+                        for (int x = columnStart[cx]; x < x1; ++x) {
+                            if (rowAlpha[x] < 255) continue;
+                            r += row[x * 3];
+                            g += row[x * 3 + 1];
+                            b += row[x * 3 + 2];
+                            ++n;
+                        }
+                    } else {
+                        for (int x = columnStart[cx]; x < x1; ++x) {
+                            r += row[x * 3];
+                            g += row[x * 3 + 1];
+                            b += row[x * 3 + 2];
+                        }
+                        n = static_cast<uint32_t>(x1 - columnStart[cx]);
+                    }
+                    uint64_t* sum = &sums[static_cast<size_t>(cx) * 4];
+                    sum[0] += r;
+                    sum[1] += g;
+                    sum[2] += b;
+                    sum[3] += n;
+                }
+            }
+            flushRow();
+            return cells;
+        }
+
+        // Wu's colour quantizer: variance-minimising box cuts over a 32^3 RGB histogram with
+        // cumulative moments, so every box statistic is an 8-corner lookup
+        class WuQuantizer {
+        public:
+            std::vector<uint32_t> Quantize(const std::vector<uint32_t>& colours, const std::vector<uint32_t>& counts,
+                                           int maxColors) {
+                m_weights.assign(kTotalSize, 0);
+                m_momentsR.assign(kTotalSize, 0);
+                m_momentsG.assign(kTotalSize, 0);
+                m_momentsB.assign(kTotalSize, 0);
+                m_moments.assign(kTotalSize, 0.0);
+
+                for (size_t i = 0; i < colours.size(); ++i) {
+                    int r = (colours[i] >> 16) & 0xFF, g = (colours[i] >> 8) & 0xFF, b = colours[i] & 0xFF;
+                    int index = Index((r >> 3) + 1, (g >> 3) + 1, (b >> 3) + 1);
+                    int64_t count = counts[i];
+                    m_weights[index] += count;
+                    m_momentsR[index] += count * r;
+                    m_momentsG[index] += count * g;
+                    m_momentsB[index] += count * b;
+                    m_moments[index] += static_cast<double>(count) * (r * r + g * g + b * b);
+                }
+                BuildMoments();
+
+                std::vector<Box> boxes(std::max(maxColors, 1));
+                std::vector<double> variance(boxes.size(), 0.0);
+                boxes[0] = { 0, kSide - 1, 0, kSide - 1, 0, kSide - 1, 0 };
+                size_t generated = boxes.size();
+                size_t next = 0;
+                for (size_t i = 1; i < boxes.size(); ++i) {
+                    if (Cut(boxes[next], boxes[i])) {
+                        variance[next] = boxes[next].volume > 1 ? Variance(boxes[next]) : 0.0;
+                        variance[i] = boxes[i].volume > 1 ? Variance(boxes[i]) : 0.0;
+                    } else {
+                        variance[next] = 0.0;
+                        --i;
+                    }
+
+                    next = 0;
+                    double largest = variance[0];
+                    for (size_t j = 1; j <= i; ++j) {
+                        if (variance[j] > largest) {
+                            largest = variance[j];
+                            next = j;
+                        }
+                    }
+                    if (largest <= 0.0) {
+                        generated = i + 1;
+                        break;
+                    }
+                }
+
+                std::vector<uint32_t> result;
+                for (size_t i = 0; i < generated; ++i) {
+                    int64_t weight = Volume(boxes[i], m_weights);
+                    if (weight <= 0) continue;
+                    uint32_t r = static_cast<uint32_t>(Volume(boxes[i], m_momentsR) / weight);
+                    uint32_t g = static_cast<uint32_t>(Volume(boxes[i], m_momentsG) / weight);
+                    uint32_t b = static_cast<uint32_t>(Volume(boxes[i], m_momentsB) / weight);
+                    result.push_back((r << 16) | (g << 8) | b);
+                }
+                return result;
+            }
+
+        private:
+            static constexpr int kSide = 33;   // 32 bins per channel plus the zero border
+            static constexpr int kTotalSize = kSide * kSide * kSide;
+            enum Axis { Red, Green, Blue };
+
+            // Half-open in the cumulative tables: (r0, r1] x (g0, g1] x (b0, b1]
+            struct Box {
+                int r0, r1, g0, g1, b0, b1, volume;
+            };
+
+            static int Index(int r, int g, int b) { return r * kSide * kSide + g * kSide + b; }
+
+            void BuildMoments() {
+                for (int r = 1; r < kSide; ++r) {
+                    int64_t area[kSide] = {}, areaR[kSide] = {}, areaG[kSide] = {}, areaB[kSide] = {};
+                    double area2[kSide] = {};
+                    for (int g = 1; g < kSide; ++g) {
+                        int64_t line = 0, lineR = 0, lineG = 0, lineB = 0;
+                        double line2 = 0.0;
+                        for (int b = 1; b < kSide; ++b) {
+                            int index = Index(r, g, b);
+                            line += m_weights[index];
+                            lineR += m_momentsR[index];
+                            lineG += m_momentsG[index];
+                            lineB += m_momentsB[index];
+                            line2 += m_moments[index];
+                            area[b] += line;
+                            areaR[b] += lineR;
+                            areaG[b] += lineG;
+                            areaB[b] += lineB;
+                            area2[b] += line2;
+                            int previous = Index(r - 1, g, b);
+                            m_weights[index] = m_weights[previous] + area[b];
+                            m_momentsR[index] = m_momentsR[previous] + areaR[b];
+                            m_momentsG[index] = m_momentsG[previous] + areaG[b];
+                            m_momentsB[index] = m_momentsB[previous] + areaB[b];
+                            m_moments[index] = m_moments[previous] + area2[b];
+                        }
+                    }
+                }
+            }
+
+            template<typename T>
+            static T Volume(const Box& box, const std::vector<T>& m) {
+                return m[Index(box.r1, box.g1, box.b1)] - m[Index(box.r1, box.g1, box.b0)] -
+                       m[Index(box.r1, box.g0, box.b1)] + m[Index(box.r1, box.g0, box.b0)] -
+                       m[Index(box.r0, box.g1, box.b1)] + m[Index(box.r0, box.g1, box.b0)] +
+                       m[Index(box.r0, box.g0, box.b1)] - m[Index(box.r0, box.g0, box.b0)];
+            }
+
+            // Part of the box's sum below its lower face on the axis
+            static int64_t Bottom(const Box& box, Axis axis, const std::vector<int64_t>& m) {
+                switch (axis) {
+                    case Red:
+                        return -m[Index(box.r0, box.g1, box.b1)] + m[Index(box.r0, box.g1, box.b0)] +
+                               m[Index(box.r0, box.g0, box.b1)] - m[Index(box.r0, box.g0, box.b0)];
+                    case Green:
+                        return -m[Index(box.r1, box.g0, box.b1)] + m[Index(box.r1, box.g0, box.b0)] +
+                               m[Index(box.r0, box.g0, box.b1)] - m[Index(box.r0, box.g0, box.b0)];
+                    case Blue:
+                    default:
+                        return -m[Index(box.r1, box.g1, box.b0)] + m[Index(box.r1, box.g0, box.b0)] +
+                               m[Index(box.r0, box.g1, box.b0)] - m[Index(box.r0, box.g0, box.b0)];
+                }
+            }
+
+            // Cumulative sum up to position on the axis, over the box's other two extents
+            static int64_t Top(const Box& box, Axis axis, int position, const std::vector<int64_t>& m) {
+                switch (axis) {
+                    case Red:
+                        return m[Index(position, box.g1, box.b1)] - m[Index(position, box.g1, box.b0)] -
+                               m[Index(position, box.g0, box.b1)] + m[Index(position, box.g0, box.b0)];
+                    case Green:
+                        return m[Index(box.r1, position, box.b1)] - m[Index(box.r1, position, box.b0)] -
+                               m[Index(box.r0, position, box.b1)] + m[Index(box.r0, position, box.b0)];
+                    case Blue:
+                    default:
+                        return m[Index(box.r1, box.g1, position)] - m[Index(box.r1, box.g0, position)] -
+                               m[Index(box.r0, box.g1, position)] + m[Index(box.r0, box.g0, position)];
+                }
+            }
+
+            double Variance(const Box& box) const {
+                double dr = static_cast<double>(Volume(box, m_momentsR));
+                double dg = static_cast<double>(Volume(box, m_momentsG));
+                double db = static_cast<double>(Volume(box, m_momentsB));
+                double xx = Volume(box, m_moments);
+                double hypotenuse = dr * dr + dg * dg + db * db;
+                return xx - hypotenuse / static_cast<double>(Volume(box, m_weights));
+            }
+
+            // Best cut position on one axis and the between-halves score it reaches (-1: none)
+            int Maximize(const Box& box, Axis axis, int first, int last, int64_t wholeR, int64_t wholeG,
+                         int64_t wholeB, int64_t wholeW, double* maximum) const {
+                int64_t bottomR = Bottom(box, axis, m_momentsR);
+                int64_t bottomG = Bottom(box, axis, m_momentsG);
+                int64_t bottomB = Bottom(box, axis, m_momentsB);
+                int64_t bottomW = Bottom(box, axis, m_weights);
+
+                *maximum = 0.0;
+                int cut = -1;
+                for (int i = first; i < last; ++i) {
+                    double halfR = static_cast<double>(bottomR + Top(box, axis, i, m_momentsR));
+                    double halfG = static_cast<double>(bottomG + Top(box, axis, i, m_momentsG));
+                    double halfB = static_cast<double>(bottomB + Top(box, axis, i, m_momentsB));
+                    double halfW = static_cast<double>(bottomW + Top(box, axis, i, m_weights));
+                    if (halfW == 0.0) continue;
+                    double score = (halfR * halfR + halfG * halfG + halfB * halfB) / halfW;
+
+                    halfR = wholeR - halfR;
+                    halfG = wholeG - halfG;
+                    halfB = wholeB - halfB;
+                    halfW = wholeW - halfW;
+                    if (halfW == 0.0) continue;
+                    score += (halfR * halfR + halfG * halfG + halfB * halfB) / halfW;
+
+                    if (score > *maximum) {
+                        *maximum = score;
+                        cut = i;
+                    }
+                }
+                return cut;
+            }
+
+            bool Cut(Box& one, Box& two) const {
+                int64_t wholeR = Volume(one, m_momentsR);
+                int64_t wholeG = Volume(one, m_momentsG);
+                int64_t wholeB = Volume(one, m_momentsB);
+                int64_t wholeW = Volume(one, m_weights);
+
+                double maxR, maxG, maxB;
+                int cutR = Maximize(one, Red, one.r0 + 1, one.r1, wholeR, wholeG, wholeB, wholeW, &maxR);
+                int cutG = Maximize(one, Green, one.g0 + 1, one.g1, wholeR, wholeG, wholeB, wholeW, &maxG);
+                int cutB = Maximize(one, Blue, one.b0 + 1, one.b1, wholeR, wholeG, wholeB, wholeW, &maxB);
+
+                Axis axis;
+                if (maxR >= maxG && maxR >= maxB) {
+                    if (cutR < 0) return false;
+                    axis = Red;
+                } else if (maxG >= maxR && maxG >= maxB) {
+                    axis = Green;
+                } else {
+                    axis = Blue;
+                }
+
+                two.r1 = one.r1;
+                two.g1 = one.g1;
+                two.b1 = one.b1;
+                switch (axis) {
+                    case Red:
+                        one.r1 = cutR;
+                        two.r0 = one.r1;
+                        two.g0 = one.g0;
+                        two.b0 = one.b0;
+                        break;
+                    case Green:
+                        one.g1 = cutG;
+                        two.r0 = one.r0;
+                        two.g0 = one.g1;
+                        two.b0 = one.b0;
+                        break;
+                    case Blue:
+                        one.b1 = cutB;
+                        two.r0 = one.r0;
+                        two.g0 = one.g0;
+                        two.b0 = one.b1;
+                        break;
+                }
+                one.volume = (one.r1 - one.r0) * (one.g1 - one.g0) * (one.b1 - one.b0);
+                two.volume = (two.r1 - two.r0) * (two.g1 - two.g0) * (two.b1 - two.b0);
+                return true;
+            }
+
+            std::vector<int64_t> m_weights, m_momentsR, m_momentsG, m_momentsB;
+            std::vector<double> m_moments;
+        };
+
+        // CIELAB (D65) for the k-means distance, where equal steps look about equally different
+        constexpr double kWhite[3] = { 95.047, 100.0, 108.883 };
+
+        double LabF(double t) {
+            const double e = 216.0 / 24389.0, kappa = 24389.0 / 27.0;
+            return t > e ? std::cbrt(t) : (kappa * t + 16.0) / 116.0;
+        }
+
+        double LabFInverse(double ft) {
+            const double e = 216.0 / 24389.0, kappa = 24389.0 / 27.0;
+            double ft3 = ft * ft * ft;
+            return ft3 > e ? ft3 : (116.0 * ft - 16.0) / kappa;
+        }
+
+        void LabFromRgb(uint32_t rgb, float lab[3]) {
+            double r = MD3SrgbToLinear((rgb >> 16) & 0xFF) * 100.0;
+            double g = MD3SrgbToLinear((rgb >> 8) & 0xFF) * 100.0;
+            double b = MD3SrgbToLinear(rgb & 0xFF) * 100.0;
+            double fx = LabF((0.41233895 * r + 0.35762064 * g + 0.18051042 * b) / kWhite[0]);
+            double fy = LabF((0.2126 * r + 0.7152 * g + 0.0722 * b) / kWhite[1]);
+            double fz = LabF((0.01932141 * r + 0.11916382 * g + 0.95034478 * b) / kWhite[2]);
+            lab[0] = static_cast<float>(116.0 * fy - 16.0);
+            lab[1] = static_cast<float>(500.0 * (fx - fy));
+            lab[2] = static_cast<float>(200.0 * (fy - fz));
+        }
+
+        wxColour RgbFromLab(double l, double a, double b) {
+            double fy = (l + 16.0) / 116.0;
+            double x = LabFInverse(fy + a / 500.0) * kWhite[0];
+            double y = LabFInverse(fy) * kWhite[1];
+            double z = LabFInverse(fy - b / 200.0) * kWhite[2];
+            double linear[3] = {
+                3.2413774792388685 * x - 1.5376652402851851 * y - 0.49885366846268053 * z,
+                -0.9691452513005321 * x + 1.8758853451067872 * y + 0.04156585616912061 * z,
+                0.05562093689691305 * x - 0.20395524564742123 * y + 1.0571799111220335 * z,
+            };
+            return MD3FromStraightLinear(static_cast<float>(linear[0] / 100.0), static_cast<float>(linear[1] / 100.0),
+                                         static_cast<float>(linear[2] / 100.0), 1.0f);
+        }
+
+        uint32_t PackRgb(const wxColour& colour) {
+            return (static_cast<uint32_t>(colour.Red()) << 16) | (colour.Green() << 8) | colour.Blue();
+        }
+
+        wxColour UnpackRgb(uint32_t rgb) {
+            return wxColour((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF);
+        }
+
+        // MD3ExtractSeedColor with the seeds as 0xRRGGBB: every wxColour it touches is its
+        // own, so it is safe on a worker thread (wxColour reference counts are not atomic)
+        uint32_t ExtractSeedRgb(const wxImage& image, uint32_t fallback, const MD3QuantizerOptions& options) {
+            std::vector<MD3SeedCandidate> candidates = MD3ScoreSeedColors(MD3QuantizeImage(image, options), 1);
+            uint32_t seed = candidates.empty() ? fallback : PackRgb(candidates.front().colour);
+            MD3CorePalette::Get(UnpackRgb(seed));
+            return seed;
+        }
+    } // namespace
+
+    std::vector<MD3QuantizedColor> MD3QuantizeImage(const wxImage& image, const MD3QuantizerOptions& options) {
+        std::vector<MD3QuantizedColor> result;
+        if (!image.IsOk()) return result;
+
+        // Unique sample colours with their cell counts
+        std::vector<uint32_t> cells = SampleImage(image, options.maxSampleSize);
+        if (cells.empty()) return result;
+        std::sort(cells.begin(), cells.end());
+        std::vector<uint32_t> colours, counts;
+        for (size_t i = 0; i < cells.size();) {
+            size_t run = i;
+            while (run < cells.size() && cells[run] == cells[i]) ++run;
+            colours.push_back(cells[i]);
+            counts.push_back(static_cast<uint32_t>(run - i));
+            i = run;
+        }
+
+        std::vector<uint32_t> seeds = WuQuantizer().Quantize(colours, counts, options.maxColors);
+        const size_t n = colours.size();
+        const size_t k = seeds.size();
+
+        // Weighted k-means in Lab, starting from the Wu box means
+        std::vector<float> pointPlanes(n * 3), centrePlanes(k * 3);
+        float* points[3] = { pointPlanes.data(), pointPlanes.data() + n, pointPlanes.data() + 2 * n };
+        float* centres[3] = { centrePlanes.data(), centrePlanes.data() + k, centrePlanes.data() + 2 * k };
+        for (size_t i = 0; i < n; ++i) {
+            float lab[3];
+            LabFromRgb(colours[i], lab);
+            for (int c = 0; c < 3; ++c) points[c][i] = lab[c];
+        }
+        for (size_t j = 0; j < k; ++j) {
+            float lab[3];
+            LabFromRgb(seeds[j], lab);
+            for (int c = 0; c < 3; ++c) centres[c][j] = lab[c];
+        }
+
+        std::vector<uint32_t> nearest(n), previous(n, UINT32_MAX);
+        std::vector<float> distance(n);
+        std::vector<double> sums(k * 4);
+        const float* const pointsIn[3] = { points[0], points[1], points[2] };
+        const float* const centresIn[3] = { centres[0], centres[1], centres[2] };
+        for (int iteration = 0; iteration < std::max(options.maxIterations, 1); ++iteration) {
+            MD3FindNearestCentres(pointsIn, n, centresIn, k, nearest.data(), distance.data());
+
+            size_t moved = 0;
+            std::fill(sums.begin(), sums.end(), 0.0);
+            for (size_t i = 0; i < n; ++i) {
+                moved += nearest[i] != previous[i];
+                double* sum = &sums[nearest[i] * 4];
+                for (int c = 0; c < 3; ++c) sum[c] += static_cast<double>(points[c][i]) * counts[i];
+                sum[3] += counts[i];
+            }
+            previous.swap(nearest);
+            if (moved == 0) break;
+
+            // Empty clusters keep their centre
+            for (size_t j = 0; j < k; ++j) {
+                const double* sum = &sums[j * 4];
+                if (sum[3] <= 0.0) continue;
+                for (int c = 0; c < 3; ++c) centres[c][j] = static_cast<float>(sum[c] / sum[3]);
+            }
+        }
+
+        // Populations from the final assignment (in previous); equal colours merge
+        std::unordered_map<uint32_t, uint32_t> populations;
+        std::vector<uint32_t> clusterPopulation(k, 0);
+        for (size_t i = 0; i < n; ++i) clusterPopulation[previous[i]] += counts[i];
+        for (size_t j = 0; j < k; ++j) {
+            if (clusterPopulation[j] == 0) continue;
+            wxColour colour = RgbFromLab(centres[0][j], centres[1][j], centres[2][j]);
+            populations[PackRgb(colour)] += clusterPopulation[j];
+        }
+
+        result.reserve(populations.size());
+        for (const auto& entry : populations) {
+            MD3QuantizedColor quantized;
+            quantized.colour = UnpackRgb(entry.first);
+            quantized.population = entry.second;
+            result.push_back(quantized);
+        }
+        std::sort(result.begin(), result.end(), [](const MD3QuantizedColor& a, const MD3QuantizedColor& b) {
+            if (a.population != b.population) return a.population > b.population;
+            return a.colour.GetRGB() < b.colour.GetRGB();
+        });
+        return result;
+    }
+
+    std::vector<MD3SeedCandidate> MD3ScoreSeedColors(const std::vector<MD3QuantizedColor>& colors, size_t desired) {
+        const double kTargetChroma = 48.0;
+        const double kWeightProportion = 0.7;
+        const double kWeightChromaAbove = 0.3;
+        const double kWeightChromaBelow = 0.1;
+        const double kCutoffChroma = 5.0;
+        const double kCutoffExcitedProportion = 0.01;
+
+        std::vector<MD3SeedCandidate> chosen;
+        double populationSum = 0.0;
+        for (const MD3QuantizedColor& quantized : colors) populationSum += quantized.population;
+        if (populationSum <= 0.0 || desired == 0) return chosen;
+
+        // Share of the image per whole hue degree, then spread over a 30 degree neighbourhood
+        std::vector<MD3Hct> hcts;
+        hcts.reserve(colors.size());
+        double hueProportions[360] = {};
+        for (const MD3QuantizedColor& quantized : colors) {
+            MD3Hct hct = MD3Hct::FromColour(quantized.colour);
+            hcts.push_back(hct);
+            hueProportions[static_cast<int>(hct.hue) % 360] += quantized.population / populationSum;
+        }
+        double excitedProportions[360] = {};
+        for (int hue = 0; hue < 360; ++hue) {
+            for (int neighbour = hue - 14; neighbour < hue + 16; ++neighbour) {
+                excitedProportions[(neighbour + 360) % 360] += hueProportions[hue];
+            }
+        }
+
+        std::vector<MD3SeedCandidate> scored;
+        std::vector<double> scoredHues;
+        for (size_t i = 0; i < colors.size(); ++i) {
+            const MD3Hct& hct = hcts[i];
+            double proportion = excitedProportions[static_cast<int>(std::lround(hct.hue)) % 360];
+            if (hct.chroma < kCutoffChroma || proportion <= kCutoffExcitedProportion) continue;
+
+            double chromaWeight = hct.chroma < kTargetChroma ? kWeightChromaBelow : kWeightChromaAbove;
+            MD3SeedCandidate candidate;
+            candidate.colour = colors[i].colour;
+            candidate.population = colors[i].population;
+            candidate.score = proportion * 100.0 * kWeightProportion + (hct.chroma - kTargetChroma) * chromaWeight;
+            scored.push_back(candidate);
+            scoredHues.push_back(hct.hue);
+        }
+        std::vector<size_t> order(scored.size());
+        for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return scored[a].score > scored[b].score; });
+
+        // Prefer hues far apart; narrow the required gap until enough candidates fit
+        std::vector<size_t> picks;
+        for (int gap = 90; gap >= 15; --gap) {
+            picks.clear();
+            for (size_t index : order) {
+                bool distinct = std::none_of(picks.begin(), picks.end(), [&](size_t pick) {
+                    double difference = std::fabs(scoredHues[index] - scoredHues[pick]);
+                    return std::min(difference, 360.0 - difference) < gap;
+                });
+                if (distinct) picks.push_back(index);
+                if (picks.size() >= desired) break;
+            }
+            if (picks.size() >= desired) break;
+        }
+
+        for (size_t pick : picks) chosen.push_back(scored[pick]);
+        return chosen;
+    }
+
+    wxColour MD3ExtractSeedColor(const wxImage& image, const wxColour& fallback, const MD3QuantizerOptions& options) {
+        std::vector<MD3SeedCandidate> candidates = MD3ScoreSeedColors(MD3QuantizeImage(image, options), 1);
+        wxColour seed = candidates.empty() ? fallback : candidates.front().colour;
+        MD3CorePalette::Get(seed);
+        return seed;
+    }
+
+    void MD3ExtractSeedColorAsync(const wxImage& image, wxEvtHandler* owner,
+                                  std::function<void(const wxColour&)> onSeed, const wxColour& fallback) {
+        if (!onSeed) return;
+        if (!image.IsOk()) {
+            wxLogWarning("MD3ExtractSeedColorAsync: invalid image, using the fallback seed");
+            onSeed(fallback);
+            return;
+        }
+        if (!wxTheApp) {
+            // No event loop to return to
+            onSeed(MD3ExtractSeedColor(image, fallback));
+            return;
+        }
+
+        // The job holds a reference to the image (wxImage and wxColour reference counts are
+        // not atomic), so it is created and destroyed on the UI thread; the worker only reads
+        // pixels, and colours cross threads as plain 0xRRGGBB
+        struct Job {
+            wxImage image;
+            wxWeakRef<wxEvtHandler> owner;
+            bool hasOwner;
+            std::function<void(const wxColour&)> onSeed;
+            uint32_t fallback;
+            uint32_t seed;
+        };
+        Job* job = new Job{ image, owner, owner != nullptr, std::move(onSeed), PackRgb(fallback), 0 };
+
+        std::thread([job]() {
+            job->seed = ExtractSeedRgb(job->image, job->fallback, MD3QuantizerOptions());
+            // Shutting down: the pending call (and the job) may never be delivered
+            if (wxTheApp) {
+                wxTheApp->CallAfter([job]() {
+                    std::unique_ptr<Job> done(job);
+                    if (!done->hasOwner || done->owner) {
+                        done->onSeed(UnpackRgb(done->seed));
+                    }
+                });
+            }
+        }).detach();
+    }
+
+} // namespace wx_md3
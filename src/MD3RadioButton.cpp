@@ -160,11 +160,11 @@ namespace wx_md3 {
             return;
         }
 
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         
         // 🔧 首先绘制背景（清除之前的内容）
         wxColour clearColor = GetParent() ? GetParent()->GetBackgroundColour() : *wxWHITE;
-        dc.SetBrush(wxBrush(clearColor));
+        dc.SetBrush(theme.GetBrush(clearColor));
         dc.SetPen(*wxTRANSPARENT_PEN);
         dc.DrawRectangle(0, 0, size.GetWidth(), size.GetHeight());
 
@@ -178,20 +178,20 @@ namespace wx_md3 {
         wxColour bgColor;
         
         if (m_selected) {
-            bgColor = theme->GetColor("primary");
+            bgColor = theme.GetColor(MD3ColorRole::Primary);
         } else {
-            bgColor = (m_state == MD3State::Hover) ? theme->GetColor("surfaceVariant") : *wxWHITE;
+            bgColor = (m_state == MD3State::Hover) ? theme.GetColor(MD3ColorRole::SurfaceVariant) : *wxWHITE;
         }
         
         // Draw radio button outer circle
-        dc.SetBrush(wxBrush(bgColor));
-        dc.SetPen(wxPen(borderColor, m_strokeWidth));
+        dc.SetBrush(theme.GetBrush(bgColor));
+        dc.SetPen(theme.GetPen(borderColor, m_strokeWidth));
         dc.DrawCircle(radioCenterX, radioCenterY, m_size / 2);
         
         // Draw filled dot if selected
         if (m_selected) {
-            wxColour dotColor = theme->GetColor("onPrimary");
-            dc.SetBrush(wxBrush(dotColor));
+            wxColour dotColor = theme.GetColor(MD3ColorRole::OnPrimary);
+            dc.SetBrush(theme.GetBrush(dotColor));
             dc.SetPen(*wxTRANSPARENT_PEN);
             
             // Calculate dot size based on fill progress
@@ -205,7 +205,7 @@ namespace wx_md3 {
             int labelY = (size.GetHeight() - dc.GetCharHeight()) / 2;
             
             // 🔧 确保设置字体和文字颜色
-            dc.SetTextForeground(theme->GetColor("onSurface"));
+            dc.SetTextForeground(theme.GetColor(MD3ColorRole::OnSurface));
             dc.SetFont(GetFont());
             dc.SetBrush(*wxTRANSPARENT_BRUSH);
             dc.SetPen(*wxTRANSPARENT_PEN);
@@ -215,20 +215,11 @@ namespace wx_md3 {
     }
 
     wxColour MD3RadioButton::GetRadioColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
-        
-        switch (m_state) {
-            case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
-            case MD3State::Pressed:
-                return theme->Darken(theme->GetColor("primary"), 0.1f);
-            default:
-                return theme->GetColor("primary");
-        }
+        return MD3Theme::GetCurrent().GetStateColor(MD3ColorRole::Primary, MD3ToColorState(m_state));
     }
 
     wxColour MD3RadioButton::GetBorderColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         
         if (m_selected) {
             return GetRadioColor();
@@ -236,11 +227,11 @@ namespace wx_md3 {
         
         switch (m_state) {
             case MD3State::Hover:
-                return theme->GetColor("onSurfaceVariant");
+                return theme.GetColor(MD3ColorRole::OnSurfaceVariant);
             case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
+                return theme.GetColor(MD3ColorRole::SurfaceVariant);
             default:
-                return theme->GetColor("outline");
+                return theme.GetColor(MD3ColorRole::Outline);
         }
     }
 
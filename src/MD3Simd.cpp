@@ -0,0 +1,75 @@
+#include "wx_md3/core/MD3Simd.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace wx_md3 {
+
+    static MD3SimdLevel DetectSimdLevel() {
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(MD3_HAVE_AVX2_KERNELS)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return MD3SimdLevel::AVX2;
+        }
+#endif
+        return __builtin_cpu_supports("sse2") ? MD3SimdLevel::SSE2 : MD3SimdLevel::Scalar;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+#if defined(MD3_HAVE_AVX2_KERNELS)
+        if (maxLeaf >= 7) {
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            __cpuidex(info, 7, 0);
+            bool avx2 = (info[1] & (1 << 5)) != 0;
+            // The OS must also save the YMM registers on context switch
+            if (osxsave && avx && avx2 && (_xgetbv(0) & 0x6) == 0x6) {
+                return MD3SimdLevel::AVX2;
+            }
+        }
+#endif
+        if (maxLeaf >= 1) {
+            __cpuid(info, 1);
+            if (info[3] & (1 << 26)) {
+                return MD3SimdLevel::SSE2;
+            }
+        }
+        return MD3SimdLevel::Scalar;
+#else
+        return MD3SimdLevel::Scalar;
+#endif
+    }
+
+    static MD3SimdLevel& ActiveSimdLevel() {
+        static MD3SimdLevel level = MD3GetSupportedSimdLevel();
+        return level;
+    }
+
+    MD3SimdLevel MD3GetSupportedSimdLevel() {
+        static const MD3SimdLevel supported = DetectSimdLevel();
+        return supported;
+    }
+
+    MD3SimdLevel MD3GetSimdLevel() {
+        return ActiveSimdLevel();
+    }
+
+    void MD3SetSimdLevel(MD3SimdLevel level) {
+        MD3SimdLevel supported = MD3GetSupportedSimdLevel();
+        ActiveSimdLevel() = static_cast<int>(level) > static_cast<int>(supported) ? supported : level;
+    }
+
+    const char* MD3GetSimdLevelName(MD3SimdLevel level) {
+        switch (level) {
+            case MD3SimdLevel::SSE2: return "SSE2";
+            case MD3SimdLevel::AVX2: return "AVX2";
+            case MD3SimdLevel::Scalar:
+            default: return "Scalar";
+        }
+    }
+
+} // namespace wx_md3
@@ -58,7 +58,10 @@ namespace wx_md3 {
 
     // Destructor
     MD3Switch::~MD3Switch() {
-        // Cleanup resources
+        // The spring writes into m_slideProgress; take it out of the animator first
+        if (m_slideSpring) {
+            MD3Animator::GetInstance().RemoveAnimation(m_slideSpring);
+        }
     }
 
     // Set switch state
@@ -66,34 +69,48 @@ namespace wx_md3 {
         if (m_enabled != value) {
             m_enabled = value;
             
-            // ✨ 使用 MD3Animator 创建流畅的动画过渡
+            // ✨ 使用弹簧动画：切换中途再次切换时保留当前位置和速度
             float targetProgress = value ? 1.0f : 0.0f;
-            float startProgress = m_slideProgress;
-            
-            // 创建动画对象
             auto animator = &MD3Animator::GetInstance();
-            m_slideAnimation = animator->CreatePropertyAnimation<float>(
-                MD3AnimationType::ThumbSlide,
-                &m_slideProgress,
-                startProgress,
-                targetProgress,
-                300,  // 300ms 动画时长
-                MD3Easing::EaseInOut
-            );
-            
-            // 设置动画更新回调 - 每帧刷新界面
-            m_slideAnimation->SetOnUpdateCallback([this]() {
-                Refresh();
-                Update();
-            });
-            
-            // 动画完成回调
-            m_slideAnimation->SetOnCompleteCallback([this]() {
+
+            if (!animator->ShouldAnimate(MD3AnimationType::ThumbSlide)) {
+                // Reduced motion: move the thumb straight to its end with a single repaint
+                if (m_slideSpring) {
+                    animator->RemoveAnimation(m_slideSpring);
+                    m_slideSpring->Stop();
+                }
+                m_slideProgress = targetProgress;
                 Refresh();
-                Update();
-            });
-            
-            // 启动动画
+                return;
+            }
+
+            if (!m_slideSpring) {
+                m_slideSpring = std::make_shared<MD3SpringAnimation>(
+                    &m_slideProgress,
+                    targetProgress,
+                    MD3SpringAnimation::StiffnessMedium,
+                    MD3SpringAnimation::DampingNoBouncy,
+                    MD3AnimationType::ThumbSlide
+                );
+                m_slideSpring->SetOwner(this);  // 不可见时暂停
+
+                // 每帧刷新界面（按帧合并）
+                m_slideSpring->SetOnUpdateCallback([this]() {
+                    MD3Animator::GetInstance().RequestRepaint(this);
+                });
+            }
+
+            // 正在运动时 SetFinalValue 会从当前位置和速度平滑转向新目标
+            MD3AnimationState state = m_slideSpring->GetState();
+            m_slideSpring->SetFinalValue(targetProgress);
+            if (state == MD3AnimationState::Paused) {
+                m_slideSpring->Resume();
+            } else if (state != MD3AnimationState::Playing) {
+                animator->RemoveAnimation(m_slideSpring);  // 避免重复加入
+                animator->AddAnimation(m_slideSpring);
+                m_slideSpring->Start();
+            }
+
             animator->Start();
         }
     }
@@ -193,10 +210,12 @@ namespace wx_md3 {
     static void DrawParentBackgroundFallback(wxWindow* win, wxDC& dc, const wxRect& rect) {
         if (!win) return;
 
+        const MD3Theme& theme = MD3Theme::GetCurrent();
+
         wxWindow* parent = win->GetParent();
         if (!parent) {
             // 没有父窗口：用窗口默认背景色填充
-            dc.SetBrush(wxBrush(win->GetBackgroundColour()));
+            dc.SetBrush(theme.GetBrush(win->GetBackgroundColour()));
             dc.SetPen(*wxTRANSPARENT_PEN);
             dc.DrawRectangle(rect);
             return;
@@ -240,7 +259,7 @@ namespace wx_md3 {
         wxRect rect(0, 0, size.GetWidth(), size.GetHeight());
         DrawParentBackgroundFallback(this, dc, rect);
 
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         
         // Draw switch track
         int switchX = 4;
@@ -251,7 +270,7 @@ namespace wx_md3 {
         wxColour thumbColor = GetThumbColor();
         
         // Draw track background
-        dc.SetBrush(wxBrush(trackColor));
+        dc.SetBrush(theme.GetBrush(trackColor));
         dc.SetPen(*wxTRANSPARENT_PEN);
         dc.DrawRoundedRectangle(switchX, switchY, trackWidth, m_trackHeight, m_trackHeight / 2.0f);
         
@@ -261,7 +280,7 @@ namespace wx_md3 {
         int thumbY = switchY + (m_trackHeight - m_thumbSize) / 2;
         
         // Draw thumb circle
-        dc.SetBrush(wxBrush(thumbColor));
+        dc.SetBrush(theme.GetBrush(thumbColor));
         dc.SetPen(*wxTRANSPARENT_PEN);
         dc.DrawCircle(thumbX + m_thumbSize / 2, thumbY + m_thumbSize / 2, m_thumbSize / 2);
         
@@ -271,7 +290,7 @@ namespace wx_md3 {
             int labelY = (size.GetHeight() - dc.GetCharHeight()) / 2;
             
             // 🔧 确保设置字体和文字颜色
-            dc.SetTextForeground(theme->GetColor("onSurface"));
+            dc.SetTextForeground(theme.GetColor(MD3ColorRole::OnSurface));
             dc.SetFont(GetFont());
             dc.SetBrush(*wxTRANSPARENT_BRUSH);
             dc.SetPen(*wxTRANSPARENT_PEN);
@@ -281,34 +300,34 @@ namespace wx_md3 {
     }
 
     wxColour MD3Switch::GetTrackColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         
         if (m_enabled) {
-            return theme->GetColor("primary");
+            return theme.GetColor(MD3ColorRole::Primary);
         }
         
         switch (m_state) {
             case MD3State::Hover:
-                return theme->GetColor("surfaceVariant");
+                return theme.GetColor(MD3ColorRole::SurfaceVariant);
             case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
+                return theme.GetColor(MD3ColorRole::SurfaceVariant);
             default:
-                return theme->GetColor("surfaceVariant");
+                return theme.GetColor(MD3ColorRole::SurfaceVariant);
         }
     }
 
     wxColour MD3Switch::GetThumbColor() const {
-        auto theme = MD3Theme::GetCurrentTheme();
+        const MD3Theme& theme = MD3Theme::GetCurrent();
         
         if (m_enabled) {
-            return theme->GetColor("onPrimary");
+            return theme.GetColor(MD3ColorRole::OnPrimary);
         }
         
         switch (m_state) {
             case MD3State::Disabled:
-                return theme->GetColor("surfaceVariant");
+                return theme.GetColor(MD3ColorRole::SurfaceVariant);
             default:
-                return theme->GetColor("outline");
+                return theme.GetColor(MD3ColorRole::Outline);
         }
     }
 
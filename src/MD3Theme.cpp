@@ -1,9 +1,163 @@
 #include "wx_md3/core/MD3Theme.h"
+#include "wx_md3/core/MD3Hct.h"
+#include "wx_md3/core/MD3Control.h"
 #include <wx/window.h>
 #include <wx/log.h>
+#include <wx/settings.h>
+#include <cstdint>
+#include <cstring>
 
 namespace wx_md3 {
 
+    namespace {
+        struct RoleEntry {
+            const char* name;
+            wxColour MD3ColorScheme::* member;
+            MD3ColorRole layer;     // State layer colour of a container role; Count for content roles
+        };
+
+        constexpr MD3ColorRole kContent = MD3ColorRole::Count;
+
+        // Indexed by MD3ColorRole
+        constexpr RoleEntry kRoles[] = {
+            { "primary", &MD3ColorScheme::primary, MD3ColorRole::OnPrimary },
+            { "onPrimary", &MD3ColorScheme::onPrimary, kContent },
+            { "primaryContainer", &MD3ColorScheme::primaryContainer, MD3ColorRole::OnPrimaryContainer },
+            { "onPrimaryContainer", &MD3ColorScheme::onPrimaryContainer, kContent },
+            { "secondary", &MD3ColorScheme::secondary, MD3ColorRole::OnSecondary },
+            { "onSecondary", &MD3ColorScheme::onSecondary, kContent },
+            { "secondaryContainer", &MD3ColorScheme::secondaryContainer, MD3ColorRole::OnSecondaryContainer },
+            { "onSecondaryContainer", &MD3ColorScheme::onSecondaryContainer, kContent },
+            { "tertiary", &MD3ColorScheme::tertiary, MD3ColorRole::OnTertiary },
+            { "onTertiary", &MD3ColorScheme::onTertiary, kContent },
+            { "tertiaryContainer", &MD3ColorScheme::tertiaryContainer, MD3ColorRole::OnTertiaryContainer },
+            { "onTertiaryContainer", &MD3ColorScheme::onTertiaryContainer, kContent },
+            { "error", &MD3ColorScheme::error, MD3ColorRole::OnError },
+            { "onError", &MD3ColorScheme::onError, kContent },
+            { "errorContainer", &MD3ColorScheme::errorContainer, MD3ColorRole::OnErrorContainer },
+            { "onErrorContainer", &MD3ColorScheme::onErrorContainer, kContent },
+            { "background", &MD3ColorScheme::background, MD3ColorRole::OnBackground },
+            { "onBackground", &MD3ColorScheme::onBackground, kContent },
+            { "surface", &MD3ColorScheme::surface, MD3ColorRole::OnSurface },
+            { "onSurface", &MD3ColorScheme::onSurface, kContent },
+            { "surfaceVariant", &MD3ColorScheme::surfaceVariant, MD3ColorRole::OnSurfaceVariant },
+            { "onSurfaceVariant", &MD3ColorScheme::onSurfaceVariant, kContent },
+            { "outline", &MD3ColorScheme::outline, kContent },
+            { "outlineVariant", &MD3ColorScheme::outlineVariant, kContent },
+            { "shadow", &MD3ColorScheme::shadow, kContent },
+            { "scrim", &MD3ColorScheme::scrim, kContent },
+            { "surfaceTint", &MD3ColorScheme::surfaceTint, kContent },
+            { "inverseSurface", &MD3ColorScheme::inverseSurface, MD3ColorRole::InverseOnSurface },
+            { "inverseOnSurface", &MD3ColorScheme::inverseOnSurface, kContent },
+            { "inversePrimary", &MD3ColorScheme::inversePrimary, kContent },
+        };
+        constexpr size_t kRoleCount = sizeof(kRoles) / sizeof(kRoles[0]);
+        static_assert(kRoleCount == static_cast<size_t>(MD3ColorRole::Count), "kRoles must list every MD3ColorRole");
+
+        // Perfect hash over the role names: FNV-1a with a seed found at compile time so
+        // that every name lands in its own slot, then one strcmp to reject other strings
+        constexpr size_t kHashSlots = 128;
+        constexpr uint8_t kNoRole = 0xFF;
+
+        constexpr uint32_t HashName(const char* name, uint32_t seed) {
+            uint32_t hash = 2166136261u ^ seed;
+            for (; *name; ++name) {
+                hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+            }
+            return hash ^ (hash >> 15);
+        }
+
+        constexpr bool IsPerfect(uint32_t seed) {
+            bool used[kHashSlots] = {};
+            for (size_t i = 0; i < kRoleCount; ++i) {
+                size_t slot = HashName(kRoles[i].name, seed) & (kHashSlots - 1);
+                if (used[slot]) return false;
+                used[slot] = true;
+            }
+            return true;
+        }
+
+        constexpr uint32_t FindSeed() {
+            uint32_t seed = 0;
+            while (!IsPerfect(seed)) ++seed;
+            return seed;
+        }
+
+        constexpr uint32_t kHashSeed = FindSeed();
+
+        struct HashTable {
+            uint8_t slots[kHashSlots];
+        };
+
+        constexpr HashTable BuildHashTable() {
+            HashTable table = {};
+            for (size_t i = 0; i < kHashSlots; ++i) table.slots[i] = kNoRole;
+            for (size_t i = 0; i < kRoleCount; ++i) {
+                table.slots[HashName(kRoles[i].name, kHashSeed) & (kHashSlots - 1)] = static_cast<uint8_t>(i);
+            }
+            return table;
+        }
+
+        constexpr HashTable kHashTable = BuildHashTable();
+
+        struct TypeScaleEntry {
+            int pointSize;
+            wxFontWeight weight;
+        };
+
+        // Indexed by MD3TypographyRole. LabelLarge and BodyMedium keep the sizes the button
+        // and checkbox labels have always used; the rest of the scale is spaced around them.
+        constexpr TypeScaleEntry kTypeScale[] = {
+            { 16, wxFONTWEIGHT_NORMAL },    // TitleLarge
+            { 12, wxFONTWEIGHT_MEDIUM },    // TitleMedium
+            { 11, wxFONTWEIGHT_MEDIUM },    // TitleSmall
+            { 12, wxFONTWEIGHT_NORMAL },    // BodyLarge
+            { 11, wxFONTWEIGHT_NORMAL },    // BodyMedium
+            { 9, wxFONTWEIGHT_NORMAL },     // BodySmall
+            { 12, wxFONTWEIGHT_BOLD },      // LabelLarge
+            { 10, wxFONTWEIGHT_MEDIUM },    // LabelMedium
+            { 9, wxFONTWEIGHT_MEDIUM },     // LabelSmall
+        };
+        static_assert(sizeof(kTypeScale) / sizeof(kTypeScale[0]) == static_cast<size_t>(MD3TypographyRole::Count),
+                      "kTypeScale must list every MD3TypographyRole");
+
+        uint64_t ResourceKey(const wxColour& colour, int width, int style) {
+            uint64_t rgba = (static_cast<uint64_t>(colour.Red()) << 24) | (static_cast<uint64_t>(colour.Green()) << 16) |
+                            (static_cast<uint64_t>(colour.Blue()) << 8) | colour.Alpha();
+            return rgba | (static_cast<uint64_t>(static_cast<uint16_t>(width)) << 32) |
+                   (static_cast<uint64_t>(static_cast<uint16_t>(style)) << 48);
+        }
+
+        // Longest role name plus terminator, with room to spare
+        constexpr size_t kMaxNameLength = 32;
+    } // namespace
+
+    bool MD3FindColorRole(const char* name, MD3ColorRole* role) {
+        if (!name) return false;
+        uint8_t index = kHashTable.slots[HashName(name, kHashSeed) & (kHashSlots - 1)];
+        if (index == kNoRole || std::strcmp(name, kRoles[index].name) != 0) return false;
+        if (role) *role = static_cast<MD3ColorRole>(index);
+        return true;
+    }
+
+    bool MD3FindColorRole(const wxString& name, MD3ColorRole* role) {
+        // Role names are short ASCII: copy into a stack buffer instead of converting
+        char buffer[kMaxNameLength];
+        size_t length = 0;
+        for (wxString::const_iterator it = name.begin(); it != name.end(); ++it) {
+            wxUniChar c = *it;
+            if (length + 1 >= kMaxNameLength || !c.IsAscii()) return false;
+            buffer[length++] = static_cast<char>(c.GetValue());
+        }
+        buffer[length] = '\0';
+        return MD3FindColorRole(buffer, role);
+    }
+
+    const char* MD3GetColorRoleName(MD3ColorRole role) {
+        size_t index = static_cast<size_t>(role);
+        return index < kRoleCount ? kRoles[index].name : "";
+    }
+
     // Define static member
     std::shared_ptr<MD3Theme> MD3Theme::s_currentTheme = nullptr;
 
@@ -11,11 +165,11 @@ namespace wx_md3 {
     wxDEFINE_EVENT(wxEVT_MD3_THEME_CHANGED, wxCommandEvent);
 
     // Constructor
-    MD3Theme::MD3Theme() : m_themeType(MD3ThemeType::Light), m_dynamicColors(false), m_colorMapBuilt(false) {
+    MD3Theme::MD3Theme() : m_themeType(MD3ThemeType::Light), m_dynamicColors(false), m_seedColor(103, 80, 164) {
         InitializeLightColors();
     }
 
-    MD3Theme::MD3Theme(MD3ThemeType type) : m_themeType(type), m_dynamicColors(false), m_colorMapBuilt(false) {
+    MD3Theme::MD3Theme(MD3ThemeType type) : m_themeType(type), m_dynamicColors(false), m_seedColor(103, 80, 164) {
         if (type == MD3ThemeType::Light) {
             InitializeLightColors();
         } else {
@@ -32,28 +186,29 @@ namespace wx_md3 {
     void MD3Theme::SetThemeType(MD3ThemeType type) {
         if (m_themeType != type) {
             m_themeType = type;
-            if (type == MD3ThemeType::Light) {
+            if (m_dynamicColors) {
+                InitializeDynamicColors();
+            } else if (type == MD3ThemeType::Light) {
                 InitializeLightColors();
             } else {
                 InitializeDarkColors();
             }
-
-            // Send theme change event
-            wxCommandEvent event(wxEVT_MD3_THEME_CHANGED, wxID_ANY);
-            // Note: Static theme change event needs special handling
+            NotifyIfCurrent();
         }
     }
 
-    // Get specific color
-    wxColour MD3Theme::GetColor(const wxString& colorName) const {
-        // Build color map (if not already built)
-        if (!m_colorMapBuilt) {
-            const_cast<MD3Theme*>(this)->BuildColorMap();
+    // Only the current theme is painted with, so only its changes reach the controls
+    void MD3Theme::NotifyIfCurrent() const {
+        if (s_currentTheme.get() == this) {
+            MD3Control::NotifyThemeChanged();
         }
+    }
 
-        auto it = m_colorMap.find(colorName);
-        if (it != m_colorMap.end()) {
-            return it->second;
+    // Get specific color by name
+    wxColour MD3Theme::GetColor(const wxString& colorName) const {
+        MD3ColorRole role;
+        if (MD3FindColorRole(colorName, &role)) {
+            return GetColor(role);
         }
 
         // 🔧 添加警告日志以便调试
@@ -61,6 +216,14 @@ namespace wx_md3 {
         return wxColour(0, 0, 0);
     }
 
+    wxColour MD3Theme::GetColor(const char* colorName) const {
+        MD3ColorRole role;
+        if (MD3FindColorRole(colorName, &role)) {
+            return GetColor(role);
+        }
+        return GetColor(wxString(colorName));
+    }
+
     // Apply theme to window
     void MD3Theme::ApplyToWindow(wxWindow* window) const {
         if (!window) return;
@@ -89,12 +252,17 @@ namespace wx_md3 {
         return s_currentTheme;
     }
 
+    const MD3Theme& MD3Theme::GetCurrent() {
+        if (!s_currentTheme) {
+            s_currentTheme = GetDefaultLightTheme();
+        }
+        return *s_currentTheme;
+    }
+
     void MD3Theme::SetCurrentTheme(std::shared_ptr<MD3Theme> theme) {
+        if (theme == s_currentTheme) return;
         s_currentTheme = theme;
-
-        // Send theme change event
-        wxCommandEvent event(wxEVT_MD3_THEME_CHANGED, wxID_ANY);
-        // Note: Global theme change event needs special handling
+        MD3Control::NotifyThemeChanged();
     }
 
     // Material You support (dynamic colors)
@@ -111,9 +279,21 @@ namespace wx_md3 {
                     InitializeDarkColors();
                 }
             }
+            NotifyIfCurrent();
         }
     }
 
+    void MD3Theme::SetSeedColor(const wxColour& seed) {
+        if (!seed.IsOk()) {
+            wxLogWarning("MD3Theme::SetSeedColor: invalid seed colour ignored");
+            return;
+        }
+        m_seedColor = seed;
+        m_dynamicColors = true;
+        InitializeDynamicColors();
+        NotifyIfCurrent();
+    }
+
     // Initialize light colors
     void MD3Theme::InitializeLightColors() {
         // Material Design 3 light theme colors
@@ -153,8 +333,7 @@ namespace wx_md3 {
         m_colorScheme.inverseOnSurface = wxColour(245, 239, 244); // #F4EFF4
         m_colorScheme.inversePrimary = wxColour(208, 188, 255); // #D0BCFF
 
-        // Mark color map as needing rebuild
-        m_colorMapBuilt = false;
+        SyncRoleColors();
     }
 
     // Initialize dark colors
@@ -196,19 +375,83 @@ namespace wx_md3 {
         m_colorScheme.inverseOnSurface = wxColour(49, 48, 51); // #313033
         m_colorScheme.inversePrimary = wxColour(103, 80, 164); // #6750A4
 
-        // Mark color map as needing rebuild
-        m_colorMapBuilt = false;
+        SyncRoleColors();
     }
 
     // Initialize dynamic colors (Material You)
     void MD3Theme::InitializeDynamicColors() {
-        // In actual implementation, this would generate dynamic color scheme based on system theme color
-        // Currently we just use default colors
+        // Material You "tonal spot" tone mapping over the seed's core palettes
+        std::shared_ptr<const MD3CorePalette> palette = MD3CorePalette::Get(m_seedColor);
+        const MD3TonalPalette& p = palette->primary;
+        const MD3TonalPalette& s = palette->secondary;
+        const MD3TonalPalette& t = palette->tertiary;
+        const MD3TonalPalette& e = palette->error;
+        const MD3TonalPalette& n = palette->neutral;
+        const MD3TonalPalette& nv = palette->neutralVariant;
+        MD3ColorScheme& c = m_colorScheme;
+
         if (m_themeType == MD3ThemeType::Light) {
-            InitializeLightColors();
+            c.primary = p.GetTone(40);
+            c.onPrimary = p.GetTone(100);
+            c.primaryContainer = p.GetTone(90);
+            c.onPrimaryContainer = p.GetTone(10);
+            c.secondary = s.GetTone(40);
+            c.onSecondary = s.GetTone(100);
+            c.secondaryContainer = s.GetTone(90);
+            c.onSecondaryContainer = s.GetTone(10);
+            c.tertiary = t.GetTone(40);
+            c.onTertiary = t.GetTone(100);
+            c.tertiaryContainer = t.GetTone(90);
+            c.onTertiaryContainer = t.GetTone(10);
+            c.error = e.GetTone(40);
+            c.onError = e.GetTone(100);
+            c.errorContainer = e.GetTone(90);
+            c.onErrorContainer = e.GetTone(10);
+            c.background = n.GetTone(99);
+            c.onBackground = n.GetTone(10);
+            c.surface = n.GetTone(99);
+            c.onSurface = n.GetTone(10);
+            c.surfaceVariant = nv.GetTone(90);
+            c.onSurfaceVariant = nv.GetTone(30);
+            c.outline = nv.GetTone(50);
+            c.outlineVariant = nv.GetTone(80);
+            c.inverseSurface = n.GetTone(20);
+            c.inverseOnSurface = n.GetTone(95);
+            c.inversePrimary = p.GetTone(80);
         } else {
-            InitializeDarkColors();
+            c.primary = p.GetTone(80);
+            c.onPrimary = p.GetTone(20);
+            c.primaryContainer = p.GetTone(30);
+            c.onPrimaryContainer = p.GetTone(90);
+            c.secondary = s.GetTone(80);
+            c.onSecondary = s.GetTone(20);
+            c.secondaryContainer = s.GetTone(30);
+            c.onSecondaryContainer = s.GetTone(90);
+            c.tertiary = t.GetTone(80);
+            c.onTertiary = t.GetTone(20);
+            c.tertiaryContainer = t.GetTone(30);
+            c.onTertiaryContainer = t.GetTone(90);
+            c.error = e.GetTone(80);
+            c.onError = e.GetTone(20);
+            c.errorContainer = e.GetTone(30);
+            c.onErrorContainer = e.GetTone(90);
+            c.background = n.GetTone(10);
+            c.onBackground = n.GetTone(90);
+            c.surface = n.GetTone(10);
+            c.onSurface = n.GetTone(90);
+            c.surfaceVariant = nv.GetTone(30);
+            c.onSurfaceVariant = nv.GetTone(80);
+            c.outline = nv.GetTone(60);
+            c.outlineVariant = nv.GetTone(30);
+            c.inverseSurface = n.GetTone(90);
+            c.inverseOnSurface = n.GetTone(20);
+            c.inversePrimary = p.GetTone(40);
         }
+        c.shadow = n.GetTone(0);
+        c.scrim = n.GetTone(0);
+        c.surfaceTint = c.primary;
+
+        SyncRoleColors();
     }
 
     // Color conversion helper functions
@@ -238,47 +481,107 @@ namespace wx_md3 {
         return wxColour(color.Red(), color.Green(), color.Blue(), a);
     }
 
-    // Build color map
-    void MD3Theme::BuildColorMap() {
-        m_colorMap.clear();
-
-        m_colorMap["primary"] = m_colorScheme.primary;
-        m_colorMap["onPrimary"] = m_colorScheme.onPrimary;
-        m_colorMap["primaryContainer"] = m_colorScheme.primaryContainer;
-        m_colorMap["onPrimaryContainer"] = m_colorScheme.onPrimaryContainer;
-
-        m_colorMap["secondary"] = m_colorScheme.secondary;
-        m_colorMap["onSecondary"] = m_colorScheme.onSecondary;
-        m_colorMap["secondaryContainer"] = m_colorScheme.secondaryContainer;
-        m_colorMap["onSecondaryContainer"] = m_colorScheme.onSecondaryContainer;
-
-        m_colorMap["tertiary"] = m_colorScheme.tertiary;
-        m_colorMap["onTertiary"] = m_colorScheme.onTertiary;
-        m_colorMap["tertiaryContainer"] = m_colorScheme.tertiaryContainer;
-        m_colorMap["onTertiaryContainer"] = m_colorScheme.onTertiaryContainer;
-
-        m_colorMap["error"] = m_colorScheme.error;
-        m_colorMap["onError"] = m_colorScheme.onError;
-        m_colorMap["errorContainer"] = m_colorScheme.errorContainer;
-        m_colorMap["onErrorContainer"] = m_colorScheme.onErrorContainer;
-
-        m_colorMap["background"] = m_colorScheme.background;
-        m_colorMap["onBackground"] = m_colorScheme.onBackground;
-        m_colorMap["surface"] = m_colorScheme.surface;
-        m_colorMap["onSurface"] = m_colorScheme.onSurface;
-        m_colorMap["surfaceVariant"] = m_colorScheme.surfaceVariant;
-        m_colorMap["onSurfaceVariant"] = m_colorScheme.onSurfaceVariant;
-        m_colorMap["outline"] = m_colorScheme.outline;
-        m_colorMap["outlineVariant"] = m_colorScheme.outlineVariant;
-        m_colorMap["shadow"] = m_colorScheme.shadow;
-        m_colorMap["scrim"] = m_colorScheme.scrim;
-
-        m_colorMap["surfaceTint"] = m_colorScheme.surfaceTint;
-        m_colorMap["inverseSurface"] = m_colorScheme.inverseSurface;
-        m_colorMap["inverseOnSurface"] = m_colorScheme.inverseOnSurface;
-        m_colorMap["inversePrimary"] = m_colorScheme.inversePrimary;
-
-        m_colorMapBuilt = true;
+    namespace {
+        // Opaque source-over of layer at opacity onto base
+        wxColour Composite(const wxColour& base, const wxColour& layer, float opacity) {
+            auto mix = [opacity](unsigned char from, unsigned char to) {
+                return static_cast<unsigned char>(from + (to - from) * opacity + 0.5f);
+            };
+            return wxColour(mix(base.Red(), layer.Red()), mix(base.Green(), layer.Green()),
+                            mix(base.Blue(), layer.Blue()), base.Alpha());
+        }
+    } // namespace
+
+    float MD3Theme::GetStateLayerOpacity(MD3ColorState state) {
+        switch (state) {
+            case MD3ColorState::Hovered:  return 0.08f;
+            case MD3ColorState::Focused:  return 0.10f;
+            case MD3ColorState::Pressed:  return 0.10f;
+            case MD3ColorState::Dragged:  return 0.16f;
+            default:                      return 0.0f;
+        }
+    }
+
+    const wxPen& MD3Theme::GetPen(const wxColour& colour, int width, wxPenStyle style) const {
+        uint64_t key = ResourceKey(colour, width, style);
+        auto it = m_pens.find(key);
+        if (it != m_pens.end()) {
+            m_resourceStats.penHits++;
+            return it->second;
+        }
+
+        m_resourceStats.penMisses++;
+        if (m_pens.size() >= kMaxCachedResources) {
+            m_pens.clear();
+            m_resourceStats.flushes++;
+        }
+        return m_pens.emplace(key, wxPen(colour, width, style)).first->second;
+    }
+
+    const wxBrush& MD3Theme::GetBrush(const wxColour& colour, wxBrushStyle style) const {
+        uint64_t key = ResourceKey(colour, 0, style);
+        auto it = m_brushes.find(key);
+        if (it != m_brushes.end()) {
+            m_resourceStats.brushHits++;
+            return it->second;
+        }
+
+        m_resourceStats.brushMisses++;
+        if (m_brushes.size() >= kMaxCachedResources) {
+            m_brushes.clear();
+            m_resourceStats.flushes++;
+        }
+        return m_brushes.emplace(key, wxBrush(colour, style)).first->second;
+    }
+
+    const wxFont& MD3Theme::GetFont(MD3TypographyRole role) const {
+        wxFont& font = m_fonts[static_cast<size_t>(role)];
+        if (font.IsOk()) {
+            m_resourceStats.fontHits++;
+            return font;
+        }
+
+        m_resourceStats.fontMisses++;
+        const TypeScaleEntry& entry = kTypeScale[static_cast<size_t>(role)];
+        font = wxSystemSettings::GetFont(wxSYS_DEFAULT_GUI_FONT);
+        font.SetPointSize(entry.pointSize);
+        font.SetWeight(entry.weight);
+        return font;
+    }
+
+    void MD3Theme::ClearResourceCache() const {
+        m_pens.clear();
+        m_brushes.clear();
+        for (wxFont& font : m_fonts) {
+            font = wxFont();
+        }
+        m_resourceStats.flushes++;
+    }
+
+    // Refresh the role and state tables from the scheme (a few hundred blends)
+    void MD3Theme::SyncRoleColors() {
+        for (size_t i = 0; i < kRoleCount; ++i) {
+            m_roleColors[i] = m_colorScheme.*kRoles[i].member;
+        }
+
+        const wxColour& surface = m_colorScheme.surface;
+        const wxColour& onSurface = m_colorScheme.onSurface;
+        const wxColour disabledContainer = Composite(surface, onSurface, 0.12f);
+        const wxColour disabledContent = Composite(surface, onSurface, 0.38f);
+        for (size_t i = 0; i < kRoleCount; ++i) {
+            const wxColour& base = m_roleColors[i];
+            wxColour* states = m_stateColors[i];
+            bool content = kRoles[i].layer == kContent;
+            for (size_t state = 0; state < static_cast<size_t>(MD3ColorState::Count); ++state) {
+                float opacity = GetStateLayerOpacity(static_cast<MD3ColorState>(state));
+                states[state] = (content || opacity == 0.0f)
+                    ? base : Composite(base, m_roleColors[static_cast<size_t>(kRoles[i].layer)], opacity);
+            }
+            states[static_cast<size_t>(MD3ColorState::Disabled)] = content ? disabledContent : disabledContainer;
+        }
+
+        // Resources built for the old scheme are not needed any more
+        ClearResourceCache();
     }
 
-} // namespace wx_md3
\ No newline at end of file
+} // namespace wx_md3
@@ -0,0 +1,219 @@
+#include "wx_md3/core/MD3Timeline.h"
+#include <wx/log.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace wx_md3 {
+
+    // MD3Timeline implementation
+    MD3Timeline::MD3Timeline()
+        : m_length(0.0f), m_repeatCount(1), m_alternate(false), m_compiled(false) {
+        // Root sequence
+        m_groups.push_back(Group{ false, 0.0f, 0.0f, 0.0f, 0.0f, 0 });
+    }
+
+    float MD3Timeline::Place(float duration) {
+        Group& group = m_groups.back();
+        float start = group.parallel ? group.start + group.stagger * static_cast<float>(group.items) : group.cursor;
+        float end = start + std::max(duration, 0.0f);
+
+        if (group.parallel) {
+            group.end = std::max(group.end, end);
+        } else {
+            group.cursor = end;
+        }
+        group.items++;
+
+        m_length = std::max(m_length, end);
+        m_compiled = false;
+        return start;
+    }
+
+    void MD3Timeline::AddSegment(float* target, float start, float end, float from, float to,
+                                 MD3Easing easing, bool fromPrevious) {
+        if (!target) return;
+        m_segments.push_back(Segment{ target, start, end, from, to, easing, fromPrevious });
+    }
+
+    MD3Timeline& MD3Timeline::Tween(float* target, float startValue, float endValue, long duration, MD3Easing easing) {
+        float start = Place(static_cast<float>(duration));
+        AddSegment(target, start, start + static_cast<float>(std::max(duration, 0L)), startValue, endValue, easing, false);
+        return *this;
+    }
+
+    MD3Timeline& MD3Timeline::To(float* target, float endValue, long duration, MD3Easing easing) {
+        float start = Place(static_cast<float>(duration));
+        AddSegment(target, start, start + static_cast<float>(std::max(duration, 0L)), endValue, endValue, easing, true);
+        return *this;
+    }
+
+    MD3Timeline& MD3Timeline::Keyframes(float* target, std::initializer_list<MD3Keyframe> keyframes) {
+        if (keyframes.size() == 0) return *this;
+
+        const MD3Keyframe* keys = keyframes.begin();
+        const size_t count = keyframes.size();
+        float start = Place(static_cast<float>(keys[count - 1].time));
+
+        if (count == 1) {
+            AddSegment(target, start, start, keys[0].value, keys[0].value, keys[0].easing, false);
+            return *this;
+        }
+        for (size_t i = 1; i < count; ++i) {
+            if (keys[i].time < keys[i - 1].time) {
+                wxLogWarning("MD3Timeline: keyframes must be in time order");
+                continue;
+            }
+            AddSegment(target, start + static_cast<float>(keys[i - 1].time), start + static_cast<float>(keys[i].time),
+                       keys[i - 1].value, keys[i].value, keys[i].easing, false);
+        }
+        return *this;
+    }
+
+    MD3Timeline& MD3Timeline::Delay(long duration) {
+        Place(static_cast<float>(duration));
+        return *this;
+    }
+
+    MD3Timeline& MD3Timeline::BeginSequence() {
+        const Group& parent = m_groups.back();
+        float start = parent.parallel ? parent.start + parent.stagger * static_cast<float>(parent.items) : parent.cursor;
+        m_groups.push_back(Group{ false, start, start, start, 0.0f, 0 });
+        return *this;
+    }
+
+    MD3Timeline& MD3Timeline::BeginParallel(long stagger) {
+        const Group& parent = m_groups.back();
+        float start = parent.parallel ? parent.start + parent.stagger * static_cast<float>(parent.items) : parent.cursor;
+        m_groups.push_back(Group{ true, start, start, start, static_cast<float>(std::max(stagger, 0L)), 0 });
+        return *this;
+    }
+
+    MD3Timeline& MD3Timeline::End() {
+        if (m_groups.size() <= 1) {
+            wxLogWarning("MD3Timeline: End() without a matching Begin");
+            return *this;
+        }
+
+        // The finished group becomes one item of its parent (Place() computes the same start)
+        Group group = m_groups.back();
+        m_groups.pop_back();
+        float end = group.parallel ? group.end : group.cursor;
+        Place(end - group.start);
+        return *this;
+    }
+
+    MD3Timeline& MD3Timeline::SetRepeat(int count, bool alternate) {
+        m_repeatCount = count < 0 ? -1 : count;
+        m_alternate = alternate;
+        return *this;
+    }
+
+    void MD3Timeline::Compile() {
+        if (m_groups.size() > 1) {
+            wxLogWarning("MD3Timeline: %d group(s) not closed with End()", static_cast<int>(m_groups.size() - 1));
+        }
+
+        // Group by property, then by start time (stable: equal starts keep declaration order)
+        std::stable_sort(m_segments.begin(), m_segments.end(), [](const Segment& a, const Segment& b) {
+            if (a.target != b.target) return std::less<float*>()(a.target, b.target);
+            return a.start < b.start;
+        });
+
+        m_channels.clear();
+        for (uint32_t i = 0; i < m_segments.size(); ++i) {
+            Segment& segment = m_segments[i];
+            if (m_channels.empty() || m_channels.back().target != segment.target) {
+                m_channels.push_back(Channel{ segment.target, i, 0, 0.0f });
+            } else if (segment.fromPrevious) {
+                // To() after another item on the same property: continue from its end value
+                segment.from = m_segments[i - 1].to;
+                segment.fromPrevious = false;
+            }
+            m_channels.back().count++;
+        }
+        m_compiled = true;
+    }
+
+    void MD3Timeline::Begin() {
+        if (!m_compiled) Compile();
+        for (Channel& channel : m_channels) {
+            channel.base = *channel.target;
+        }
+    }
+
+    void MD3Timeline::Evaluate(float time) {
+        for (const Channel& channel : m_channels) {
+            const Segment* first = m_segments.data() + channel.first;
+            const Segment* last = first + channel.count;
+
+            // Last segment starting at or before time; before the first one the property
+            // holds that segment's start value
+            const Segment* found = std::upper_bound(first, last, time,
+                                                    [](float t, const Segment& s) { return t < s.start; });
+            const Segment& segment = found == first ? *first : *(found - 1);
+            float from = segment.fromPrevious ? channel.base : segment.from;
+
+            float value;
+            if (time <= segment.start) {
+                value = from;
+            } else if (time >= segment.end) {
+                value = segment.to;
+            } else {
+                float progress = (time - segment.start) / (segment.end - segment.start);
+                value = MD3Animation::Lerp(from, segment.to, MD3Animation::Ease(progress, segment.easing));
+            }
+            *channel.target = value;
+        }
+    }
+
+    // MD3TimelineAnimation implementation
+    MD3TimelineAnimation::MD3TimelineAnimation(MD3Timeline timeline, MD3AnimationType type)
+        : MD3Animation(type, 0, MD3Easing::Linear), m_timeline(std::move(timeline)) {
+    }
+
+    void MD3TimelineAnimation::Start() {
+        if (m_state == MD3AnimationState::Stopped || m_state == MD3AnimationState::Completed) {
+            m_timeline.Begin();
+            int repeat = m_timeline.GetRepeatCount();
+            m_duration = repeat < 0 ? -1 : m_timeline.GetDuration() * repeat;
+        }
+        MD3Animation::Start();
+    }
+
+    void MD3TimelineAnimation::Update(float deltaTime) {
+        if (m_state != MD3AnimationState::Playing) return;
+
+        const float length = static_cast<float>(m_timeline.GetDuration());
+        const int repeat = m_timeline.GetRepeatCount();
+        m_elapsedTime += deltaTime;
+
+        // Endless: keep the clock small (an even number of passes keeps the direction)
+        if (repeat < 0 && length > 0.0f && m_elapsedTime >= 2.0f * length) {
+            m_elapsedTime = std::fmod(m_elapsedTime, 2.0f * length);
+        }
+
+        bool finished = length <= 0.0f || (repeat >= 0 && m_elapsedTime >= length * static_cast<float>(repeat));
+        int pass;
+        float time;
+        if (finished) {
+            pass = std::max(repeat, 1) - 1;
+            time = length;
+        } else {
+            pass = static_cast<int>(m_elapsedTime / length);
+            time = m_elapsedTime - static_cast<float>(pass) * length;
+        }
+        if (m_timeline.IsAlternating() && (pass % 2) == 1) {
+            time = length - time;
+        }
+
+        m_timeline.Evaluate(time);
+        if (m_onUpdate) m_onUpdate();
+
+        if (finished) {
+            m_state = MD3AnimationState::Completed;
+            if (m_onComplete) m_onComplete();
+        }
+    }
+
+} // namespace wx_md3
@@ -0,0 +1,688 @@
+#include "wx_md3/core/MD3TrackEngine.h"
+#include "wx_md3/core/MD3Animator.h"
+#include "wx_md3/core/MD3ColourSpace.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace wx_md3 {
+
+    // Value interpolation per track kind. offset is the velocity term added by a
+    // retarget (colour and point tracks do not carry velocity).
+    static inline float LerpTrackValue(float start, float end, float t, float offset) {
+        return start + (end - start) * t + offset;
+    }
+
+    static inline int LerpTrackValue(int start, int end, float t, float offset) {
+        return static_cast<int>(start + (end - start) * t + offset);
+    }
+
+    static inline wxColour LerpTrackValue(const wxColour& start, const wxColour& end, float t, float) {
+        return MD3Animator::LerpColour(start, end, t);
+    }
+
+    static inline wxRealPoint LerpTrackValue(const wxRealPoint& start, const wxRealPoint& end, float t, float) {
+        return wxRealPoint(start.x + (end.x - start.x) * t, start.y + (end.y - start.y) * t);
+    }
+
+    // Hermite basis h10(u) = u(1-u)^2 and its derivative: blends an initial velocity
+    // into the eased curve without moving either endpoint
+    static inline float VelocityWeight(float u) {
+        float v = 1.0f - u;
+        return u * v * v;
+    }
+
+    static inline float VelocityWeightSlope(float u) {
+        return (1.0f - u) * (1.0f - 3.0f * u);
+    }
+
+    // d/du of the easing curve (central difference; the curves are smooth inside [0, 1])
+    static inline float EaseSlope(float u, MD3Easing easing) {
+        const float h = 1e-3f;
+        float lo = std::max(0.0f, u - h);
+        float hi = std::min(1.0f, u + h);
+        return (MD3Animation::Ease(hi, easing) - MD3Animation::Ease(lo, easing)) / (hi - lo);
+    }
+
+    // Column implementation
+    template<typename T>
+    void MD3TrackEngine::Column<T>::Push(uint32_t slot, MD3AnimationType type, T* target, const T& startValue,
+                                         const T& endValue, float duration, MD3Easing easing) {
+        targets.push_back(target);
+        startValues.push_back(startValue);
+        endValues.push_back(endValue);
+        elapsed.push_back(0.0f);
+        durations.push_back(duration);
+        velocities.push_back(0.0f);
+        easings.push_back(easing);
+        states.push_back(MD3AnimationState::Stopped);
+        types.push_back(type);
+        slots.push_back(slot);
+        groups.push_back(0);
+        priorities.push_back(MD3DefaultPriority(type));
+        callbacks.emplace_back();
+    }
+
+    template<typename T>
+    void MD3TrackEngine::Column<T>::SwapRemove(size_t row) {
+        size_t last = targets.size() - 1;
+        if (row != last) {
+            targets[row] = targets[last];
+            startValues[row] = startValues[last];
+            endValues[row] = endValues[last];
+            elapsed[row] = elapsed[last];
+            durations[row] = durations[last];
+            velocities[row] = velocities[last];
+            easings[row] = easings[last];
+            states[row] = states[last];
+            types[row] = types[last];
+            slots[row] = slots[last];
+            groups[row] = groups[last];
+            priorities[row] = priorities[last];
+            callbacks[row] = std::move(callbacks[last]);
+        }
+        targets.pop_back();
+        startValues.pop_back();
+        endValues.pop_back();
+        elapsed.pop_back();
+        durations.pop_back();
+        velocities.pop_back();
+        easings.pop_back();
+        states.pop_back();
+        types.pop_back();
+        slots.pop_back();
+        groups.pop_back();
+        priorities.pop_back();
+        callbacks.pop_back();
+    }
+
+    template<typename T>
+    void MD3TrackEngine::Column<T>::Clear() {
+        targets.clear();
+        startValues.clear();
+        endValues.clear();
+        elapsed.clear();
+        durations.clear();
+        velocities.clear();
+        easings.clear();
+        states.clear();
+        types.clear();
+        slots.clear();
+        groups.clear();
+        priorities.clear();
+        callbacks.clear();
+    }
+
+    template struct MD3TrackEngine::Column<float>;
+    template struct MD3TrackEngine::Column<int>;
+    template struct MD3TrackEngine::Column<wxColour>;
+    template struct MD3TrackEngine::Column<wxRealPoint>;
+
+    // MD3TrackEngine implementation
+    MD3TrackEngine::MD3TrackEngine()
+        : m_groups(1), m_playingCount(0), m_culledCount(0), m_cancelledGroups(0), m_frameIndex(0),
+          m_shedSkipped(0), m_shedFinished(0), m_advancing(false), m_needsCompact(false) {
+        // Group 0 is the implicit "no owner" group
+        m_groups[0].used = true;
+        std::fill(std::begin(m_updateIntervals), std::end(m_updateIntervals), 1u);
+    }
+
+    uint32_t MD3TrackEngine::AllocateSlot(MD3TrackKind kind, uint32_t row) {
+        uint32_t index;
+        if (!m_freeSlots.empty()) {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        Slot& slot = m_slots[index];
+        slot.row = row;
+        slot.kind = kind;
+        slot.used = true;
+        return index;
+    }
+
+    const MD3TrackEngine::Slot* MD3TrackEngine::Resolve(MD3TrackId id) const {
+        if (id.index >= m_slots.size()) return nullptr;
+        const Slot& slot = m_slots[id.index];
+        if (!slot.used || slot.generation != id.generation) return nullptr;
+
+        // Tracks of a cancelled group are dead even before compaction reclaims them
+        if (m_cancelledGroups > 0) {
+            uint32_t group = Visit(slot.kind, [&](const auto& column) { return column.groups[slot.row]; });
+            if (m_groups[group].cancelled) return nullptr;
+        }
+        return &slot;
+    }
+
+    bool MD3TrackEngine::IsDead(MD3AnimationState state, uint32_t group) const {
+        return state == MD3AnimationState::Completed || m_groups[group].cancelled;
+    }
+
+    bool MD3TrackEngine::IsAlive(MD3TrackId id) const {
+        return Resolve(id) != nullptr;
+    }
+
+    void MD3TrackEngine::SetState(const Slot& slot, MD3AnimationState state, bool restart) {
+        Visit(slot.kind, [&](auto& column) {
+            MD3AnimationState& current = column.states[slot.row];
+            if (current == MD3AnimationState::Playing) m_playingCount--;
+            if (state == MD3AnimationState::Playing) m_playingCount++;
+            current = state;
+            if (restart) column.elapsed[slot.row] = 0.0f;
+        });
+    }
+
+    void MD3TrackEngine::Start(MD3TrackId id) {
+        const Slot* slot = Resolve(id);
+        if (!slot) return;
+
+        MD3AnimationState state = GetState(id);
+        if (state == MD3AnimationState::Stopped || state == MD3AnimationState::Completed) {
+            SetState(*slot, MD3AnimationState::Playing, true);
+
+            // Copy the callback out: it may add tracks and reallocate the column
+            Callback onStart = Visit(slot->kind, [&](auto& column) { return column.callbacks[slot->row].onStart; });
+            if (onStart) onStart();
+        } else if (state == MD3AnimationState::Paused) {
+            SetState(*slot, MD3AnimationState::Playing, false);
+        }
+    }
+
+    void MD3TrackEngine::Stop(MD3TrackId id) {
+        if (const Slot* slot = Resolve(id)) SetState(*slot, MD3AnimationState::Stopped, true);
+    }
+
+    void MD3TrackEngine::Pause(MD3TrackId id) {
+        const Slot* slot = Resolve(id);
+        if (slot && GetState(id) == MD3AnimationState::Playing) {
+            SetState(*slot, MD3AnimationState::Paused, false);
+        }
+    }
+
+    void MD3TrackEngine::Resume(MD3TrackId id) {
+        const Slot* slot = Resolve(id);
+        if (slot && GetState(id) == MD3AnimationState::Paused) {
+            SetState(*slot, MD3AnimationState::Playing, false);
+        }
+    }
+
+    void MD3TrackEngine::Remove(MD3TrackId id) {
+        const Slot* slot = Resolve(id);
+        if (!slot) return;
+
+        // Mark completed without firing callbacks; the row is reclaimed by Compact()
+        SetState(*slot, MD3AnimationState::Completed, false);
+        m_needsCompact = true;
+        if (!m_advancing) {
+            Compact();
+        }
+    }
+
+    MD3TrackId MD3TrackEngine::Find(MD3AnimationType type, const void* target) const {
+        auto it = m_keys.find(MD3TrackKey{ target, type });
+        if (it == m_keys.end() || GetState(it->second) == MD3AnimationState::Completed) {
+            return MD3TrackId();
+        }
+        return it->second;
+    }
+
+    template<typename T>
+    MD3TrackId MD3TrackEngine::Retarget(MD3AnimationType type, T* target, const T& endValue,
+                                        long duration, MD3Easing easing) {
+        MD3TrackId id = Find(type, target);
+        const Slot* slot = Resolve(id);
+        if (!slot || slot->kind != MD3TrackTraits<T>::kind) return MD3TrackId();
+
+        Column<T>& column = GetColumn<T>();
+        const size_t row = slot->row;
+        float velocity = 0.0f;
+
+        if (column.states[row] == MD3AnimationState::Playing) {
+            // Sample the current value and velocity analytically so int tracks keep sub-unit precision
+            float span = column.durations[row];
+            float u = span > 0.0f ? std::min(1.0f, column.elapsed[row] / span) : 1.0f;
+            MD3Easing oldEasing = column.easings[row];
+            float eased = MD3Animation::Ease(u, oldEasing);
+            float carried = column.velocities[row] * span;
+
+            if constexpr (MD3TrackTraits<T>::kind == MD3TrackKind::Colour ||
+                          MD3TrackTraits<T>::kind == MD3TrackKind::Point) {
+                column.startValues[row] = LerpTrackValue(column.startValues[row], column.endValues[row], eased, 0.0f);
+            } else {
+                float start = static_cast<float>(column.startValues[row]);
+                float delta = static_cast<float>(column.endValues[row]) - start;
+                float value = start + delta * eased + carried * VelocityWeight(u);
+                float slope = delta * EaseSlope(u, oldEasing) + carried * VelocityWeightSlope(u);
+                column.startValues[row] = static_cast<T>(std::is_integral<T>::value ? std::lround(value) : value);
+                velocity = span > 0.0f ? slope / span : 0.0f;
+            }
+        } else if (target) {
+            // Stopped or paused: continue from wherever the property currently is
+            column.startValues[row] = *target;
+        }
+
+        column.endValues[row] = endValue;
+        column.elapsed[row] = 0.0f;
+        column.durations[row] = static_cast<float>(duration);
+        column.velocities[row] = velocity;
+        column.easings[row] = easing;
+        return id;
+    }
+
+    template MD3TrackId MD3TrackEngine::Retarget<float>(MD3AnimationType, float*, const float&, long, MD3Easing);
+    template MD3TrackId MD3TrackEngine::Retarget<int>(MD3AnimationType, int*, const int&, long, MD3Easing);
+    template MD3TrackId MD3TrackEngine::Retarget<wxColour>(MD3AnimationType, wxColour*, const wxColour&, long, MD3Easing);
+    template MD3TrackId MD3TrackEngine::Retarget<wxRealPoint>(MD3AnimationType, wxRealPoint*, const wxRealPoint&, long, MD3Easing);
+
+    template<typename T>
+    MD3TrackId MD3TrackEngine::Play(MD3AnimationType type, T* target, const T& startValue, const T& endValue,
+                                    long duration, MD3Easing easing) {
+        MD3TrackId id = Find(type, target);
+        const Slot* slot = Resolve(id);
+        if (!slot || slot->kind != MD3TrackTraits<T>::kind) {
+            id = Add(type, target, startValue, endValue, duration, easing);
+            Start(id);
+            return id;
+        }
+
+        Column<T>& column = GetColumn<T>();
+        const size_t row = slot->row;
+        column.startValues[row] = startValue;
+        column.endValues[row] = endValue;
+        column.elapsed[row] = 0.0f;
+        column.durations[row] = static_cast<float>(duration);
+        column.velocities[row] = 0.0f;
+        column.easings[row] = easing;
+        if (column.states[row] != MD3AnimationState::Playing) {
+            Start(id);
+        }
+        return id;
+    }
+
+    template MD3TrackId MD3TrackEngine::Play<float>(MD3AnimationType, float*, const float&, const float&, long, MD3Easing);
+    template MD3TrackId MD3TrackEngine::Play<int>(MD3AnimationType, int*, const int&, const int&, long, MD3Easing);
+    template MD3TrackId MD3TrackEngine::Play<wxColour>(MD3AnimationType, wxColour*, const wxColour&, const wxColour&, long, MD3Easing);
+    template MD3TrackId MD3TrackEngine::Play<wxRealPoint>(MD3AnimationType, wxRealPoint*, const wxRealPoint&, const wxRealPoint&, long, MD3Easing);
+
+    MD3AnimationState MD3TrackEngine::GetState(MD3TrackId id) const {
+        const Slot* slot = Resolve(id);
+        if (!slot) return MD3AnimationState::Completed;
+        return Visit(slot->kind, [&](const auto& column) { return column.states[slot->row]; });
+    }
+
+    float MD3TrackEngine::GetElapsedTime(MD3TrackId id) const {
+        const Slot* slot = Resolve(id);
+        if (!slot) return 0.0f;
+        return Visit(slot->kind, [&](const auto& column) { return column.elapsed[slot->row]; });
+    }
+
+    void MD3TrackEngine::SetPriority(MD3TrackId id, MD3AnimationPriority priority) {
+        if (const Slot* slot = Resolve(id)) {
+            Visit(slot->kind, [&](auto& column) { column.priorities[slot->row] = priority; });
+        }
+    }
+
+    MD3AnimationPriority MD3TrackEngine::GetPriority(MD3TrackId id) const {
+        const Slot* slot = Resolve(id);
+        if (!slot) return MD3AnimationPriority::Normal;
+        return Visit(slot->kind, [&](const auto& column) { return column.priorities[slot->row]; });
+    }
+
+    void MD3TrackEngine::SetUpdateInterval(MD3AnimationPriority priority, uint32_t interval) {
+        if (priority < MD3AnimationPriority::Count) {
+            m_updateIntervals[static_cast<size_t>(priority)] = interval;
+        }
+    }
+
+    uint32_t MD3TrackEngine::GetUpdateInterval(MD3AnimationPriority priority) const {
+        return priority < MD3AnimationPriority::Count ? m_updateIntervals[static_cast<size_t>(priority)] : 1;
+    }
+
+    void MD3TrackEngine::SetOnStartCallback(MD3TrackId id, Callback callback) {
+        if (const Slot* slot = Resolve(id)) {
+            Visit(slot->kind, [&](auto& column) { column.callbacks[slot->row].onStart = std::move(callback); });
+        }
+    }
+
+    void MD3TrackEngine::SetOnUpdateCallback(MD3TrackId id, Callback callback) {
+        if (const Slot* slot = Resolve(id)) {
+            Visit(slot->kind, [&](auto& column) { column.callbacks[slot->row].onUpdate = std::move(callback); });
+        }
+    }
+
+    void MD3TrackEngine::SetOnCompleteCallback(MD3TrackId id, Callback callback) {
+        if (const Slot* slot = Resolve(id)) {
+            Visit(slot->kind, [&](auto& column) { column.callbacks[slot->row].onComplete = std::move(callback); });
+        }
+    }
+
+    uint32_t MD3TrackEngine::CreateGroup() {
+        uint32_t group;
+        if (!m_freeGroups.empty()) {
+            group = m_freeGroups.back();
+            m_freeGroups.pop_back();
+        } else {
+            group = static_cast<uint32_t>(m_groups.size());
+            m_groups.emplace_back();
+        }
+        m_groups[group] = Group();
+        m_groups[group].used = true;
+        return group;
+    }
+
+    void MD3TrackEngine::ReleaseGroup(uint32_t group) {
+        if (group == 0 || group >= m_groups.size() || !m_groups[group].used) return;
+
+        if (m_groups[group].cancelled) {
+            m_groups[group].cancelled = false;
+            m_cancelledGroups--;
+        }
+
+        if (m_groups[group].tracks > 0) {
+            auto removeRows = [&](auto& column) {
+                for (size_t row = 0; row < column.Size(); ++row) {
+                    if (column.groups[row] != group) continue;
+                    if (column.states[row] == MD3AnimationState::Playing) m_playingCount--;
+                    column.states[row] = MD3AnimationState::Completed;
+                    column.groups[row] = 0;
+                }
+            };
+            removeRows(m_floats);
+            removeRows(m_ints);
+            removeRows(m_colours);
+            removeRows(m_points);
+            m_needsCompact = true;
+            if (!m_advancing) Compact();
+        }
+
+        m_groups[group].used = false;
+        m_groups[group].tracks = 0;
+        m_freeGroups.push_back(group);
+    }
+
+    void MD3TrackEngine::SetGroup(MD3TrackId id, uint32_t group) {
+        const Slot* slot = Resolve(id);
+        if (!slot || group >= m_groups.size() || !m_groups[group].used || m_groups[group].cancelled) return;
+
+        Visit(slot->kind, [&](auto& column) {
+            uint32_t& current = column.groups[slot->row];
+            if (current == group) return;
+            if (current != 0) m_groups[current].tracks--;
+            if (group != 0) m_groups[group].tracks++;
+            current = group;
+        });
+    }
+
+    void MD3TrackEngine::SetGroupCulling(uint32_t group, MD3CullMode mode) {
+        if (group != 0 && group < m_groups.size()) m_groups[group].culling = mode;
+    }
+
+    void MD3TrackEngine::CancelGroup(uint32_t group) {
+        if (group == 0 || group >= m_groups.size() || !m_groups[group].used || m_groups[group].cancelled) return;
+
+        // No row is touched here: Advance() skips the group and Compact() drops its rows
+        m_groups[group].cancelled = true;
+        m_groups[group].culling = MD3CullMode::None;
+        m_cancelledGroups++;
+        if (m_groups[group].tracks > 0) {
+            m_needsCompact = true;
+        }
+    }
+
+    bool MD3TrackEngine::IsGroupCancelled(uint32_t group) const {
+        return group < m_groups.size() && m_groups[group].cancelled;
+    }
+
+    size_t MD3TrackEngine::GetGroupTrackCount(uint32_t group) const {
+        return group < m_groups.size() ? m_groups[group].tracks : 0;
+    }
+
+    void MD3TrackEngine::StartAll() {
+        for (uint32_t index = 0; index < m_slots.size(); ++index) {
+            MD3TrackId id;
+            id.index = index;
+            id.generation = m_slots[index].generation;
+            if (m_slots[index].used && GetState(id) == MD3AnimationState::Stopped) {
+                Start(id);
+            }
+        }
+    }
+
+    void MD3TrackEngine::StopAll() {
+        for (uint32_t index = 0; index < m_slots.size(); ++index) {
+            MD3TrackId id;
+            id.index = index;
+            id.generation = m_slots[index].generation;
+            if (m_slots[index].used && GetState(id) != MD3AnimationState::Completed) {
+                Stop(id);
+            }
+        }
+    }
+
+    void MD3TrackEngine::Clear() {
+        if (m_advancing) {
+            // Defer the actual release until the current frame finishes
+            for (uint32_t index = 0; index < m_slots.size(); ++index) {
+                MD3TrackId id;
+                id.index = index;
+                id.generation = m_slots[index].generation;
+                if (m_slots[index].used) Remove(id);
+            }
+            return;
+        }
+
+        m_floats.Clear();
+        m_ints.Clear();
+        m_colours.Clear();
+        m_points.Clear();
+        m_freeSlots.clear();
+        m_keys.clear();
+        for (Group& group : m_groups) {
+            group.tracks = 0;
+        }
+        for (uint32_t index = 0; index < m_slots.size(); ++index) {
+            if (m_slots[index].used) {
+                m_slots[index].used = false;
+                m_slots[index].generation++;
+            }
+            m_freeSlots.push_back(index);
+        }
+        m_playingCount = 0;
+        m_needsCompact = false;
+    }
+
+    size_t MD3TrackEngine::GetTrackCount() const {
+        return m_floats.Size() + m_ints.Size() + m_colours.Size() + m_points.Size();
+    }
+
+    template<typename T>
+    void MD3TrackEngine::AdvanceColumn(Column<T>& column, float deltaTime) {
+        // Tracks added by callbacks during this pass start advancing next frame
+        const size_t count = column.Size();
+
+        // Pass 1: advance clocks, finish completed tracks and bucket the rest by easing
+        for (auto& bucket : m_easeBuckets) {
+            bucket.rows.clear();
+            bucket.progress.clear();
+        }
+        for (size_t row = 0; row < count; ++row) {
+            if (column.states[row] != MD3AnimationState::Playing) continue;
+
+            // Culled owner: hold the track where it is, or run it straight to the end
+            float step = deltaTime;
+            if (uint32_t group = column.groups[row]) {
+                if (m_groups[group].cancelled) continue;
+                MD3CullMode culling = m_groups[group].culling;
+                if (culling == MD3CullMode::Pause) {
+                    m_culledCount++;
+                    continue;
+                }
+                if (culling == MD3CullMode::Finish) step = column.durations[row];
+            }
+
+            // Load shedding: finish low-priority tracks at once or update them less often
+            const uint32_t interval = m_updateIntervals[static_cast<size_t>(column.priorities[row])];
+            if (interval == 0) {
+                step = column.durations[row];
+                m_shedFinished++;
+            }
+
+            float elapsed = column.elapsed[row] + step;
+            column.elapsed[row] = elapsed;
+
+            if (elapsed >= column.durations[row]) {
+                if (column.targets[row]) *column.targets[row] = column.endValues[row];
+                column.states[row] = MD3AnimationState::Completed;
+                m_playingCount--;
+                m_needsCompact = true;
+
+                // Copy the callback (no allocation): it may add tracks and reallocate the column
+                Callback onComplete = column.callbacks[row].onComplete;
+                if (onComplete) onComplete();
+                continue;
+            }
+
+            if (interval > 1 && (m_frameIndex + column.slots[row]) % interval != 0) {
+                m_shedSkipped++;
+                continue;
+            }
+
+            size_t easing = static_cast<size_t>(column.easings[row]);
+            if (easing >= m_easeBuckets.size()) {
+                m_easeBuckets.resize(easing + 1);
+            }
+            m_easeBuckets[easing].rows.push_back(static_cast<uint32_t>(row));
+            m_easeBuckets[easing].progress.push_back(elapsed / column.durations[row]);
+        }
+
+        // Pass 2: ease each bucket in one batched call, then write the values
+        for (size_t easing = 0; easing < m_easeBuckets.size(); ++easing) {
+            EaseBucket& bucket = m_easeBuckets[easing];
+            const size_t n = bucket.rows.size();
+            if (n == 0) continue;
+
+            bucket.eased.resize(n);
+            MD3Animation::EaseBatch(bucket.progress.data(), bucket.eased.data(), n, static_cast<MD3Easing>(easing));
+
+            // Colours: interpolate the whole bucket in one batched call before writing
+            if constexpr (MD3TrackTraits<T>::kind == MD3TrackKind::Colour) {
+                LerpColourBucket(column, bucket);
+            }
+
+            for (size_t k = 0; k < n; ++k) {
+                size_t row = bucket.rows[k];
+                // A callback earlier in this pass may have stopped, removed or cancelled the track
+                if (column.states[row] != MD3AnimationState::Playing) continue;
+                if (column.groups[row] != 0 && m_groups[column.groups[row]].cancelled) continue;
+
+                if constexpr (MD3TrackTraits<T>::kind == MD3TrackKind::Colour) {
+                    if (column.targets[row]) {
+                        const float* out = m_colourPlanes.data() + 8 * n;
+                        *column.targets[row] = MD3FromStraightLinear(out[k], out[n + k], out[2 * n + k], out[3 * n + k]);
+                    }
+                } else if (column.targets[row]) {
+                    float velocity = column.velocities[row];
+                    float offset = velocity != 0.0f
+                        ? velocity * column.durations[row] * VelocityWeight(bucket.progress[k]) : 0.0f;
+                    *column.targets[row] = LerpTrackValue(column.startValues[row], column.endValues[row],
+                                                          bucket.eased[k], offset);
+                }
+                if (column.callbacks[row].onUpdate) {
+                    Callback onUpdate = column.callbacks[row].onUpdate;
+                    onUpdate();
+                }
+            }
+        }
+    }
+
+    void MD3TrackEngine::LerpColourBucket(const Column<wxColour>& column, const EaseBucket& bucket) {
+        // Planes: start r g b a, end r g b a, out r g b a (n floats each)
+        const size_t n = bucket.rows.size();
+        m_colourPlanes.resize(12 * n);
+        float* planes = m_colourPlanes.data();
+        const float* start[4] = { planes, planes + n, planes + 2 * n, planes + 3 * n };
+        const float* end[4] = { planes + 4 * n, planes + 5 * n, planes + 6 * n, planes + 7 * n };
+        float* out[4] = { planes + 8 * n, planes + 9 * n, planes + 10 * n, planes + 11 * n };
+
+        for (size_t k = 0; k < n; ++k) {
+            size_t row = bucket.rows[k];
+            MD3LinearColour from = MD3ToLinearColour(column.startValues[row]);
+            MD3LinearColour to = MD3ToLinearColour(column.endValues[row]);
+            planes[k] = from.r;
+            planes[n + k] = from.g;
+            planes[2 * n + k] = from.b;
+            planes[3 * n + k] = from.a;
+            planes[4 * n + k] = to.r;
+            planes[5 * n + k] = to.g;
+            planes[6 * n + k] = to.b;
+            planes[7 * n + k] = to.a;
+        }
+        MD3LerpColourPlanes(start, end, bucket.eased.data(), out, n);
+    }
+
+    template<typename T>
+    void MD3TrackEngine::CompactColumn(Column<T>& column) {
+        size_t row = 0;
+        while (row < column.Size()) {
+            if (!IsDead(column.states[row], column.groups[row])) {
+                ++row;
+                continue;
+            }
+
+            // Release the id, then move the last row into this one
+            if (column.states[row] == MD3AnimationState::Playing) m_playingCount--;
+            if (column.groups[row] != 0) m_groups[column.groups[row]].tracks--;
+
+            Slot& released = m_slots[column.slots[row]];
+            released.used = false;
+            released.generation++;
+            m_freeSlots.push_back(column.slots[row]);
+
+            column.SwapRemove(row);
+            if (row < column.Size()) {
+                m_slots[column.slots[row]].row = static_cast<uint32_t>(row);
+            }
+        }
+    }
+
+    void MD3TrackEngine::Compact() {
+        CompactColumn(m_floats);
+        CompactColumn(m_ints);
+        CompactColumn(m_colours);
+        CompactColumn(m_points);
+        m_needsCompact = false;
+
+        // Stale keys are harmless (ids are generation-checked) but should not pile up
+        if (m_keys.size() > 1024 && m_keys.size() > 2 * GetTrackCount()) {
+            PruneKeys();
+        }
+    }
+
+    void MD3TrackEngine::PruneKeys() {
+        for (auto it = m_keys.begin(); it != m_keys.end();) {
+            if (IsAlive(it->second)) ++it;
+            else it = m_keys.erase(it);
+        }
+    }
+
+    void MD3TrackEngine::Advance(float deltaTime) {
+        m_advancing = true;
+        m_culledCount = 0;
+        m_shedSkipped = 0;
+        m_shedFinished = 0;
+        m_frameIndex++;
+        AdvanceColumn(m_floats, deltaTime);
+        AdvanceColumn(m_ints, deltaTime);
+        AdvanceColumn(m_colours, deltaTime);
+        AdvanceColumn(m_points, deltaTime);
+        m_advancing = false;
+
+        if (m_needsCompact) {
+            Compact();
+        }
+    }
+
+} // namespace wx_md3